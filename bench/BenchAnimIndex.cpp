@@ -0,0 +1,163 @@
+/**
+* @file BenchAnimIndex.cpp
+* @brief Ajԍ̕Ƃ̏vԂƃgpʂ̔r
+*
+* @std::unordered_map() / \[gςݔz(SAELIB_AIR_INDEX_SORTED) / nbVe[u(SAELIB_AIR_INDEX_FLAT) / ڎQƃe[u𓯂ԍŌv܂
+*
+* @gpʂ MemorySize() ̊TZƁAmی𐔂ۂ̊mۗʂ̗o͂܂
+*/
+
+#include "h_ReadAirFile.h"
+#include "h_AirGenerator.h"
+#include "h_BenchHarness.h"
+#include <iostream>		// std::cerr
+#include <map>			// ʂ̏ƍ
+#include <random>		// std::mt19937
+
+namespace {
+	constexpr std::string_view kUsage =
+		"usage: BenchAnimIndex [options]\n"
+		"  --anims=N        registered anim numbers (default 1500)\n"
+		"  --layout=NAME    clustered (0-999, 5000-5299, ...) / sequential / sparse (default clustered)\n"
+		"  --miss=R         ratio of lookups for missing numbers (default 0.25)\n"
+		"  --lookups=N      lookups per measurement (default 1000000)\n"
+		"  --repeat=N       repetitions, the median is reported (default 5)\n"
+		"  --seed=N         random seed (default 1)\n";
+
+	// mے̃oCg𐔂mی
+	struct T_CountingResource final : std::pmr::memory_resource {
+		size_t Allocated = 0;
+
+		void* do_allocate(size_t Bytes, size_t Alignment) override {
+			Allocated += Bytes;
+			return std::pmr::new_delete_resource()->allocate(Bytes, Alignment);
+		}
+		void do_deallocate(void* Ptr, size_t Bytes, size_t Alignment) override {
+			Allocated -= Bytes;
+			std::pmr::new_delete_resource()->deallocate(Ptr, Bytes, Alignment);
+		}
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& Other) const noexcept override { return this == &Other; }
+	};
+
+	// o^Ajԍ(AIRt@CƓAނˏ)
+	std::vector<int32_t> MakeKey(std::string_view Layout, int32_t NumAnim, std::mt19937& Random) {
+		std::vector<int32_t> Key = {};
+		for (int32_t i = 0; static_cast<int32_t>(Key.size()) < NumAnim; ++i) {
+			if (Layout == "sequential") { Key.push_back(i); }
+			else if (Layout == "sparse") { Key.push_back(i * 97 + static_cast<int32_t>(Random() % 97)); }
+			else { Key.push_back(i < 1000 ? i : 5000 + (i - 1000) / 300 * 1000 + (i - 1000) % 300); }
+		}
+		return Key;
+	}
+
+	struct T_Result {
+		int64_t BuildTime = 0;
+		int64_t LookupTime = 0;
+		size_t MemorySize = 0;
+		size_t Allocated = 0;
+		int64_t Checksum = 0;
+	};
+
+	template <class T_Index, class T_Build>
+	T_Result Measure(const std::vector<int32_t>& Key, const std::vector<int32_t>& Query, int32_t Repeat, T_Build&& Build) {
+		T_Result Result = {};
+		Result.BuildTime = SAELib::AirBench::MedianNs(Repeat, [&]() {
+			T_CountingResource Resource;
+			T_Index Index(&Resource);
+			for (int32_t Value : Key) { Index.Register(Value); }
+			Build(Index);
+			SAELib::AirBench::Sink = static_cast<int64_t>(Index.size());
+		});
+
+		T_CountingResource Resource;
+		T_Index Index(&Resource);
+		for (int32_t Value : Key) { Index.Register(Value); }
+		Build(Index);
+		Result.MemorySize = Index.MemorySize();
+		Result.Allocated = Resource.Allocated;
+		Result.LookupTime = SAELib::AirBench::MedianNs(Repeat, [&]() {
+			int64_t Sum = 0;
+			for (int32_t Value : Query) { Sum += Index.find(Value); }
+			Result.Checksum = Sum;
+			SAELib::AirBench::Sink = Sum;
+		});
+		return Result;
+	}
+
+	void Report(std::string_view Name, const T_Result& Result, size_t NumKey, size_t NumQuery) {
+		std::printf("%-16.*s %10.2f ns/lookup %10.2f ns/insert %10.1f KB (MemorySize %.1f KB)\n", static_cast<int>(Name.size()), Name.data(),
+			static_cast<double>(Result.LookupTime) / static_cast<double>(NumQuery), static_cast<double>(Result.BuildTime) / static_cast<double>(NumKey),
+			static_cast<double>(Result.Allocated) / 1024.0, static_cast<double>(Result.MemorySize) / 1024.0);
+	}
+}
+
+int main(int argc, char* argv[]) {
+	namespace Detail = SAELib::ReadAirFile_detail;
+
+	int32_t NumAnim = 1500;
+	std::string Layout = "clustered";
+	double MissRate = 0.25;
+	int32_t NumLookup = 1000000;
+	int32_t Repeat = 5;
+	uint32_t Seed = 1;
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view Arg = argv[i];
+		if (SAELib::AirGenerator::ReadOption(Arg, "anims", NumAnim) || SAELib::AirGenerator::ReadOption(Arg, "layout", Layout)
+			|| SAELib::AirGenerator::ReadOption(Arg, "miss", MissRate) || SAELib::AirGenerator::ReadOption(Arg, "lookups", NumLookup)
+			|| SAELib::AirGenerator::ReadOption(Arg, "repeat", Repeat) || SAELib::AirGenerator::ReadOption(Arg, "seed", Seed)) {
+			continue;
+		}
+		std::cerr << kUsage;
+		return 1;
+	}
+	if (NumAnim <= 0 || NumLookup <= 0) {
+		std::cerr << kUsage;
+		return 1;
+	}
+
+	std::mt19937 Random(Seed);
+	const std::vector<int32_t> Key = MakeKey(Layout, NumAnim, Random);
+	std::map<int32_t, int32_t> Expected = {};
+	for (int32_t Value : Key) { Expected.try_emplace(Value, static_cast<int32_t>(Expected.size())); }
+
+	// ݂ԍƑ݂Ȃԍ
+	std::vector<int32_t> Query(static_cast<size_t>(NumLookup));
+	std::uniform_real_distribution<double> Rate(0.0, 1.0);
+	std::uniform_int_distribution<size_t> PickKey(0, Key.size() - 1);
+	std::uniform_int_distribution<int32_t> PickNumber(0, Key.back() + 1000);
+	int64_t ExpectedChecksum = 0;
+	for (int32_t& Value : Query) {
+		Value = Rate(Random) < MissRate ? PickNumber(Random) : Key[PickKey(Random)];
+		const auto it = Expected.find(Value);
+		ExpectedChecksum += it != Expected.end() ? it->second : -1;
+	}
+
+	std::printf("%zu keys (%s), %d lookups, %.0f%% miss\n", Expected.size(), Layout.c_str(), NumLookup, MissRate * 100.0);
+	const auto NoBuild = [](auto&) {};
+	const auto DenseBuild = [](Detail::T_UnorderedMap& Index) { Index.BuildDenseIndex(0); };
+	const struct {
+		std::string_view Name;
+		T_Result Result;
+	} ResultList[] = {
+		{ "unordered_map", Measure<Detail::T_StdIndex>(Key, Query, Repeat, NoBuild) },
+		{ "sorted", Measure<Detail::T_SortedIndex>(Key, Query, Repeat, NoBuild) },
+		{ "flat", Measure<Detail::T_FlatIndex>(Key, Query, Repeat, NoBuild) },
+		{ "dense", Measure<Detail::T_UnorderedMap>(Key, Query, Repeat, DenseBuild) },
+	};
+
+	bool Mismatch = false;
+	for (const auto& Entry : ResultList) {
+		Report(Entry.Name, Entry.Result, Key.size(), Query.size());
+		if (Entry.Result.Checksum != ExpectedChecksum) {
+			std::cerr << Entry.Name << ": lookup results differ from std::map\n";
+			Mismatch = true;
+		}
+	}
+
+	// ԍ͈̔͂Lꍇ͒ڎQƃe[u쐬Ȃ(dense̍s̓RpCɑǏvɂȂ)
+	Detail::T_UnorderedMap Index;
+	for (int32_t Value : Key) { Index.Register(Value); }
+	Index.BuildDenseIndex(0);
+	if (!Index.IsDenseIndex()) { std::printf("dense: number range too wide, measured the compiled backend instead\n"); }
+	return Mismatch ? 1 : 0;
+}
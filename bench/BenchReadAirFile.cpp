@@ -0,0 +1,164 @@
+/**
+* @file BenchReadAirFile.cpp
+* @brief ǂݍ݂̃X[vbgƌ̏vԂ̌v
+*
+* @AIRt@C(--fileŎw肵AIRt@C)ǂݍ݁Aȉo͂܂
+*
+* @LoadAIR / LoadAIRFromMemory ̃X[vbg(MB/sElines/sARepeat̒l)
+*
+* @GetAnimData / ExistAnimNumber(݂Ȃԍ) / GetElemData 1񂠂̏v
+*
+* @AIRf[^̃gpʂƃvZX̍ő풓
+*/
+
+#include "h_ReadAirFile.h"
+#include "h_AirGenerator.h"
+#include "h_BenchHarness.h"
+#include <fstream>			// std::ofstream
+#include <iostream>			// std::cerr
+#include <sstream>			// std::ostringstream
+#include <random>			// std::mt19937
+#include <unordered_set>	// ݂Ȃԍ̑I
+
+namespace {
+#if defined(SAELIB_AIR_INDEX_SORTED)
+	constexpr std::string_view kAnimIndexName = "sorted";
+#elif defined(SAELIB_AIR_INDEX_FLAT)
+	constexpr std::string_view kAnimIndexName = "flat";
+#else
+	constexpr std::string_view kAnimIndexName = "unordered_map";
+#endif
+
+	constexpr std::string_view kUsage =
+		"usage: BenchReadAirFile [options]\n"
+		"  --file=PATH      benchmark an existing .air file instead of generated data\n"
+		"  --repeat=N       load repetitions, the median is reported (default 5)\n"
+		"  --lookups=N      lookups per latency measurement (default 1000000)\n"
+		"  --mmap           AIRConfig::SetUseMappedFile(true)\n"
+		"  --lazy           AIRConfig::SetUseLazyParse(true)\n"
+		"  --threads=N      AIRConfig::SetParseThreadCount(N) (default 1)\n";
+
+	std::string ReadFile(const std::filesystem::path& Path) {
+		std::ifstream File(Path, std::ios::binary);
+		std::ostringstream Text;
+		Text << File.rdbuf();
+		return Text.str();
+	}
+}
+
+int main(int argc, char* argv[]) {
+	using namespace SAELib::AirBench;
+
+	SAELib::AirGenerator::T_AirGenConfig GenConfig = {};
+	std::string InputPath = {};
+	int32_t Repeat = 5;
+	int32_t NumLookup = 1000000;
+	bool UseMappedFile = false;
+	bool UseLazyParse = false;
+	int32_t NumThread = 1;
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view Arg = argv[i];
+		if (SAELib::AirGenerator::ReadGenOption(Arg, GenConfig)
+			|| SAELib::AirGenerator::ReadOption(Arg, "file", InputPath) || SAELib::AirGenerator::ReadOption(Arg, "repeat", Repeat)
+			|| SAELib::AirGenerator::ReadOption(Arg, "lookups", NumLookup) || SAELib::AirGenerator::ReadOption(Arg, "mmap", UseMappedFile)
+			|| SAELib::AirGenerator::ReadOption(Arg, "lazy", UseLazyParse) || SAELib::AirGenerator::ReadOption(Arg, "threads", NumThread)) {
+			continue;
+		}
+		std::cerr << kUsage << SAELib::AirGenerator::kGenUsage;
+		return 1;
+	}
+
+	SAELib::AIRConfig::SetThrowError(false);
+	SAELib::AIRConfig::SetCreateLogFile(false);
+	SAELib::AIRConfig::SetCreateSAELibFile(false);
+	SAELib::AIRConfig::SetUseMappedFile(UseMappedFile);
+	SAELib::AIRConfig::SetUseLazyParse(UseLazyParse);
+	SAELib::AIRConfig::SetParseThreadCount(NumThread);
+
+	// ǂݍݑΏ(f[^͈ꎞtH_֏o)
+	std::filesystem::path FilePath = InputPath;
+	if (InputPath.empty()) {
+		const std::filesystem::path Folder = std::filesystem::temp_directory_path() / "ReadAirFileBench";
+		std::filesystem::create_directories(Folder);
+		FilePath = Folder / "bench.air";
+		const std::string Text = SAELib::AirGenerator::Generate(GenConfig);
+		std::ofstream(FilePath, std::ios::binary).write(Text.data(), static_cast<std::streamsize>(Text.size()));
+	}
+	const std::string Text = ReadFile(FilePath);
+	if (Text.empty()) {
+		std::cerr << "cannot read " << FilePath.string() << "\n";
+		return 1;
+	}
+
+	// ǂݍ݂̃X[vbg
+	SAELib::AIR Air;
+	const int64_t FileTime = MedianNs(Repeat, [&]() { Air.LoadAIR(FilePath.filename().string(), FilePath.parent_path().string()); });
+	const SAELib::AIR::LoadStats FileStats = Air.GetLoadStats();
+	if (Air.empty()) {
+		std::cerr << "LoadAIR failed: " << FilePath.string() << "\n";
+		return 1;
+	}
+	const int64_t MemoryTime = MedianNs(Repeat, [&]() { Air.LoadAIRFromMemory(Text, "bench"); });
+	const SAELib::AIR::LoadStats MemoryStats = Air.GetLoadStats();
+
+	std::printf("file %s: %zu bytes, %d lines, %d anims, %d elems\n", FilePath.string().c_str(), Text.size(), MemoryStats.NumLine, Air.NumAnim(), MemoryStats.NumElem);
+	std::printf("anim index: %.*s%s\n", static_cast<int>(kAnimIndexName.size()), kAnimIndexName.data(), Air.IsDenseAnimIndex() ? " (dense table)" : "");
+	Report("LoadAIR", static_cast<double>(FileStats.FileSize) * 1e3 / static_cast<double>(FileTime), "MB/s");
+	Report("LoadAIR", static_cast<double>(FileStats.NumLine) * 1e3 / static_cast<double>(FileTime), "Mlines/s");
+	Report("LoadAIR parse only", static_cast<double>(FileStats.FileSize) * 1e3 / static_cast<double>(std::max<int64_t>(FileStats.ParseTime, 1)), "MB/s");
+	Report("LoadAIRFromMemory", static_cast<double>(MemoryStats.FileSize) * 1e3 / static_cast<double>(MemoryTime), "MB/s");
+	Report("LoadAIRFromMemory", static_cast<double>(MemoryStats.NumLine) * 1e3 / static_cast<double>(MemoryTime), "Mlines/s");
+
+	// ̏v(݂ԍE݂ȂԍEAjElem)
+	std::vector<SAELib::AIR::AnimData> AnimList = {};
+	std::unordered_set<int32_t> AnimNumberSet = {};
+	for (SAELib::AIR::AnimData Anim : Air.anims()) {
+		AnimList.push_back(Anim);
+		AnimNumberSet.insert(Anim.AnimNumber());
+	}
+	if (!AnimList.empty() && NumLookup > 0) {
+		std::mt19937 Random(GenConfig.Seed);
+		std::uniform_int_distribution<size_t> PickAnim(0, AnimList.size() - 1);
+		std::vector<int32_t> HitQuery(static_cast<size_t>(NumLookup));
+		std::vector<int32_t> MissQuery(static_cast<size_t>(NumLookup));
+		std::vector<std::pair<int32_t, int32_t>> ElemQuery(static_cast<size_t>(NumLookup));
+		const int32_t MaxAnimNumber = *std::max_element(AnimNumberSet.begin(), AnimNumberSet.end());
+		std::uniform_int_distribution<int32_t> PickNumber(0, std::max(MaxAnimNumber, 1) * 2);
+		for (size_t i = 0; i < HitQuery.size(); ++i) {
+			HitQuery[i] = AnimList[PickAnim(Random)].AnimNumber();
+			do { MissQuery[i] = PickNumber(Random); } while (AnimNumberSet.count(MissQuery[i]));
+			const size_t AnimIndex = PickAnim(Random);
+			ElemQuery[i] = { static_cast<int32_t>(AnimIndex), std::uniform_int_distribution<int32_t>(0, AnimList[AnimIndex].ElemDataSize() - 1)(Random) };
+		}
+
+		const int64_t HitTime = MedianNs(Repeat, [&]() {
+			int64_t Sum = 0;
+			for (int32_t AnimNumber : HitQuery) { Sum += Air.GetAnimData(AnimNumber).ElemDataSize(); }
+			Sink = Sum;
+		});
+		const int64_t MissTime = MedianNs(Repeat, [&]() {
+			int64_t Sum = 0;
+			for (int32_t AnimNumber : MissQuery) { Sum += Air.ExistAnimNumber(AnimNumber); }
+			Sink = Sum;
+		});
+		const int64_t ElemTime = MedianNs(Repeat, [&]() {
+			int64_t Sum = 0;
+			for (const auto& [AnimIndex, ElemIndex] : ElemQuery) { Sum += AnimList[static_cast<size_t>(AnimIndex)].GetElemData(ElemIndex).ElemTime(); }
+			Sink = Sum;
+		});
+		Report("GetAnimData", static_cast<double>(HitTime) / NumLookup, "ns/lookup");
+		Report("ExistAnimNumber (miss)", static_cast<double>(MissTime) / NumLookup, "ns/lookup");
+		Report("GetElemData", static_cast<double>(ElemTime) / NumLookup, "ns/lookup");
+	}
+
+	// gp
+	Report("AIR::MemorySize", static_cast<double>(Air.MemorySize()) / 1024.0, "KB");
+	Report("AIR::AnimIndexMemorySize", static_cast<double>(Air.AnimIndexMemorySize()) / 1024.0, "KB");
+	Report("peak RSS", static_cast<double>(PeakMemory()) / (1024.0 * 1024.0), "MB");
+
+	if (InputPath.empty()) {
+		std::error_code ErrorCode = {};
+		std::filesystem::remove(FilePath, ErrorCode);
+	}
+	return 0;
+}
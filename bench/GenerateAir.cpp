@@ -0,0 +1,30 @@
+/**
+* @file GenerateAir.cpp
+* @brief AIRt@C̏o
+*
+* @GenerateAir --anims=5000 --elems=12 --malformed=0.01 --out=big.air
+*/
+
+#include "h_AirGenerator.h"
+#include <fstream>		// std::ofstream
+#include <iostream>		// std::cout
+
+int main(int argc, char* argv[]) {
+	SAELib::AirGenerator::T_AirGenConfig Config = {};
+	std::string OutPath = {};
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view Arg = argv[i];
+		if (SAELib::AirGenerator::ReadGenOption(Arg, Config) || SAELib::AirGenerator::ReadOption(Arg, "out", OutPath)) { continue; }
+		std::cerr << "usage: GenerateAir [options]\n" << SAELib::AirGenerator::kGenUsage << "  --out=PATH       output file (default stdout)\n";
+		return 1;
+	}
+
+	const std::string Text = SAELib::AirGenerator::Generate(Config);
+	if (OutPath.empty()) {
+		std::cout.write(Text.data(), static_cast<std::streamsize>(Text.size()));
+		return std::cout ? 0 : 1;
+	}
+	std::ofstream File(OutPath, std::ios::binary);
+	File.write(Text.data(), static_cast<std::streamsize>(Text.size()));
+	return File ? 0 : 1;
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+/**
+* @file h_AirGenerator.h
+* @brief x`}[NEeXgp̍AIReLXg̐
+*
+* @AjEElemE]/߂̊ERgsEsȍs̊w肵āA̎킩͓eLXg𐶐܂
+*/
+
+#include <cstdint>		// int32_t
+#include <random>		// std::mt19937
+#include <string>		// std::string
+#include <string_view>	// std::string_view
+#include <charconv>		// std::from_chars
+#include <iterator>		// std::size
+#include <type_traits>	// std::is_same_v
+
+namespace SAELib {
+	namespace AirGenerator {
+
+		// ݒ
+		struct T_AirGenConfig {
+			int32_t NumAnim = 1000;			// Aj(dEAj)
+			int32_t NumElem = 8;			// 1AjElem
+			double FlipRate = 0.2;			// ](H / V / HV)w肷Elem̊
+			double AlphaRate = 0.2;			// (A / S / AS256D0 )w肷Elem̊
+			double CommentRate = 0.1;		// sƂɃRgsEsRg}銄
+			double MalformedRate = 0.0;		// sƂɕsȍs(͈͊O̒lEᔽEd/Aj)}銄
+			double LoopstartRate = 0.3;		// Loopstart܂ރAj̊
+			double ClsnRate = 0.5;			// Clsn2Default̋`܂ރAj̊
+			bool CRLF = false;				// s\r\nɂ
+			uint32_t Seed = 1;				// ̎
+		};
+
+		// ɓKȂA͓ǂݍݎɃG[ɂȂElemʒu̍s
+		inline constexpr std::string_view kMalformedLine[] = {
+			"0,0, 0,0",						// ڕs
+			"0,0, 0,0, 5, HQ",				// sȔ]w
+			"70000,0, 0,0, 5",				// O[vԍ͈̔͊O
+			"0,-2, 0,0, 5",					// C[Wԍ͈̔͊O
+			"0,0, 0,0, 5, , A999",			// AlphaA͈̔͊O
+			"0,0, 0,0, 5, , AS300D0",		// AlphaS͈̔͊O
+			"0,0, 99999999999,0, 5",		// lϊ̎s
+			"[Begin Action abc]",			// sȃAjԍ
+			"[Begin Action -5]",			// ̃Ajԍ
+			"Loopstart now",				// Loopstarťɕ
+			"Clsn2: x",						// sȋ`
+			"Clsn2[0] = 1, 2, 3",			// ڕs̋`
+			"garbage text",					// ֌Wȕ
+		};
+
+		/**
+		* @brief AIReLXg𐶐
+		*
+		* @Ajԍ 100 ̘AԂ 1000 Ԋuŕׂ܂(0`99, 1000`1099, ...)
+		*
+		* @MalformedRate 0 傫ꍇ́AsȍsɉēAjԍ̏dAjElem̖Aj}܂
+		*
+		* @param const T_AirGenConfig& Config ݒ
+		* @return std::string AIReLXg
+		*/
+		inline std::string Generate(const T_AirGenConfig& Config) {
+			std::mt19937 Random(Config.Seed);
+			std::uniform_real_distribution<double> Rate(0.0, 1.0);
+			const auto Roll = [&](double Value) { return Value > 0.0 && Rate(Random) < Value; };
+			const auto Pick = [&](int32_t Min, int32_t Max) { return std::uniform_int_distribution<int32_t>(Min, Max)(Random); };
+			const std::string_view NewLine = Config.CRLF ? "\r\n" : "\n";
+
+			std::string Text = {};
+			Text.reserve(static_cast<size_t>(Config.NumAnim) * (static_cast<size_t>(Config.NumElem) * 32 + 64));
+			const auto Line = [&](std::string_view Value) {
+				Text += Value;
+				Text += NewLine;
+			};
+			const auto Comment = [&]() {
+				if (Roll(Config.CommentRate)) { Line("; comment line"); }
+			};
+			const auto Malformed = [&]() {
+				if (Roll(Config.MalformedRate)) { Line(kMalformedLine[Pick(0, static_cast<int32_t>(std::size(kMalformedLine)) - 1)]); }
+			};
+			const auto Header = [&](int32_t AnimNumber) {
+				Line("[Begin Action " + std::to_string(AnimNumber) + "]" + (Roll(Config.CommentRate) ? " ; action" : ""));
+			};
+			const auto Elem = [&]() {
+				std::string Value = std::to_string(Pick(-1, 9000)) + "," + std::to_string(Pick(0, 40)) + ", "
+					+ std::to_string(Pick(-80, 80)) + "," + std::to_string(Pick(-120, 20)) + ", " + std::to_string(Pick(1, 12));
+				const bool Flip = Roll(Config.FlipRate);
+				const bool Alpha = Roll(Config.AlphaRate);
+				if (Flip || Alpha) {
+					static constexpr std::string_view kFlip[] = { "H", "V", "HV" };
+					static constexpr std::string_view kAlpha[] = { "A", "S", "A1", "AS128D128", "AS256D0" };
+					Value += ", ";
+					if (Flip) { Value += kFlip[Pick(0, 2)]; }
+					if (Alpha) {
+						Value += ", ";
+						Value += kAlpha[Pick(0, 4)];
+					}
+				}
+				if (Roll(Config.CommentRate)) { Value += " ; elem"; }
+				Line(Value);
+			};
+
+			Line("; synthetic AIR data");
+			for (int32_t AnimIndex = 0; AnimIndex < Config.NumAnim; ++AnimIndex) {
+				const int32_t AnimNumber = AnimIndex / 100 * 1000 + AnimIndex % 100;
+
+				// Ajԍ̋Aj(Aj͓o^Ȃ߁A̖{̃Ajgp)
+				if (Roll(Config.MalformedRate)) {
+					Header(AnimNumber);
+					Comment();
+				}
+				Header(AnimNumber);
+				Comment();
+				if (Roll(Config.ClsnRate)) {
+					Line("Clsn2Default: 1");
+					Line(" Clsn2[0] = -10, 0, 10, -80");
+				}
+				const int32_t Loopstart = Config.NumElem > 0 && Roll(Config.LoopstartRate) ? Pick(0, Config.NumElem - 1) : -1;
+				for (int32_t ElemIndex = 0; ElemIndex < Config.NumElem; ++ElemIndex) {
+					if (ElemIndex == Loopstart) { Line("Loopstart"); }
+					Malformed();
+					Elem();
+					Comment();
+				}
+				// Ajԍ̏dAj(ǂݔ΂)
+				if (Roll(Config.MalformedRate)) {
+					Header(AnimNumber);
+					Elem();
+				}
+				Line("");
+			}
+			return Text;
+		}
+
+		// --Name=Value `̈ǂݎ(NamevȂꍇfalse)
+		template <class T>
+		bool ReadOption(std::string_view Arg, std::string_view Name, T& Value) {
+			if (Arg.substr(0, 2) != "--" || Arg.substr(2, Name.size()) != Name) { return false; }
+			Arg.remove_prefix(2 + Name.size());
+			if constexpr (std::is_same_v<T, bool>) {
+				if (Arg.empty()) { Value = true; return true; }
+				if (Arg.front() != '=') { return false; }
+				Value = Arg.substr(1) != "0";
+				return true;
+			}
+			else if constexpr (std::is_same_v<T, std::string>) {
+				if (Arg.empty() || Arg.front() != '=') { return false; }
+				Value = std::string(Arg.substr(1));
+				return true;
+			}
+			else if constexpr (std::is_floating_point_v<T>) {
+				if (Arg.empty() || Arg.front() != '=') { return false; }
+				Value = std::stod(std::string(Arg.substr(1)));
+				return true;
+			}
+			else {
+				if (Arg.empty() || Arg.front() != '=') { return false; }
+				Arg.remove_prefix(1);
+				return std::from_chars(Arg.data(), Arg.data() + Arg.size(), Value).ec == std::errc{};
+			}
+		}
+
+		// ݒ̈ǂݎ(ݒȊÖfalse)
+		inline bool ReadGenOption(std::string_view Arg, T_AirGenConfig& Config) {
+			return ReadOption(Arg, "anims", Config.NumAnim) || ReadOption(Arg, "elems", Config.NumElem)
+				|| ReadOption(Arg, "flip", Config.FlipRate) || ReadOption(Arg, "alpha", Config.AlphaRate)
+				|| ReadOption(Arg, "comments", Config.CommentRate) || ReadOption(Arg, "malformed", Config.MalformedRate)
+				|| ReadOption(Arg, "loopstart", Config.LoopstartRate) || ReadOption(Arg, "clsn", Config.ClsnRate)
+				|| ReadOption(Arg, "crlf", Config.CRLF) || ReadOption(Arg, "seed", Config.Seed);
+		}
+
+		// ݒ̈̐
+		inline constexpr std::string_view kGenUsage =
+			"  --anims=N        anim count (default 1000)\n"
+			"  --elems=N        elements per anim (default 8)\n"
+			"  --flip=R         ratio of elements with H/V flags (default 0.2)\n"
+			"  --alpha=R        ratio of elements with alpha blending (default 0.2)\n"
+			"  --comments=R     ratio of lines followed by a comment (default 0.1)\n"
+			"  --malformed=R    ratio of malformed lines, duplicate and empty anims (default 0)\n"
+			"  --loopstart=R    ratio of anims with Loopstart (default 0.3)\n"
+			"  --clsn=R         ratio of anims with a Clsn2Default box (default 0.5)\n"
+			"  --crlf           use CRLF line endings\n"
+			"  --seed=N         random seed (default 1)\n";
+
+	}
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+/**
+* @file h_BenchHarness.h
+* @brief x`}[ŇvEo͂̋ʏ
+*/
+
+#include <cstdint>		// int64_t
+#include <cstdio>		// std::printf
+#include <chrono>		// std::chrono::steady_clock
+#include <vector>		// std::vector
+#include <algorithm>	// std::nth_element
+#include <string_view>	// std::string_view
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <psapi.h>		// ő像[LOZbg(GetProcessMemoryInfo)
+#else
+#include <sys/resource.h>	// ő풓TCY(getrusage)
+#endif
+
+namespace SAELib {
+	namespace AirBench {
+
+		// œKŌvΏۂ̏Ȃ悤ɒlo
+		inline volatile int64_t Sink = 0;
+
+		// 1̎s(imb)
+		template <class T_Func>
+		int64_t MeasureNs(T_Func&& Func) {
+			const auto Start = std::chrono::steady_clock::now();
+			Func();
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count();
+		}
+
+		// RepeatsԂ̒l(imb)
+		template <class T_Func>
+		int64_t MedianNs(int32_t Repeat, T_Func&& Func) {
+			std::vector<int64_t> Time(static_cast<size_t>(std::max(Repeat, 1)));
+			for (int64_t& Value : Time) { Value = MeasureNs(Func); }
+			std::nth_element(Time.begin(), Time.begin() + Time.size() / 2, Time.end());
+			return Time[Time.size() / 2];
+		}
+
+		// vZX̍ő풓(byteA擾łȂꍇ 0)
+		inline uint64_t PeakMemory() {
+#ifdef _WIN32
+			PROCESS_MEMORY_COUNTERS Counters = {};
+			if (!GetProcessMemoryInfo(GetCurrentProcess(), &Counters, sizeof(Counters))) { return 0; }
+			return static_cast<uint64_t>(Counters.PeakWorkingSetSize);
+#else
+			rusage Usage = {};
+			if (getrusage(RUSAGE_SELF, &Usage) != 0) { return 0; }
+#if defined(__APPLE__)
+			return static_cast<uint64_t>(Usage.ru_maxrss);			// byte
+#else
+			return static_cast<uint64_t>(Usage.ru_maxrss) * 1024;	// KB
+#endif
+#endif
+		}
+
+		// vʂ1so
+		inline void Report(std::string_view Name, double Value, std::string_view Unit) {
+			std::printf("%-32.*s %14.3f %.*s\n", static_cast<int>(Name.size()), Name.data(), Value, static_cast<int>(Unit.size()), Unit.data());
+		}
+
+	}
+}
@@ -6,13 +6,45 @@
 #include <string_view>		// std::string_vieŵ
 #include <stdexcept>		// runtime_error̂
 #include <fstream>			// t@Cǂݎ
+#include <sstream>			// LbVt@C̓ȇgݗ
 #include <filesystem>		// t@C
 #include <system_error>		// std::error_codê
 #include <vector>			// ϒz
 #include <unordered_map>	// nbVIȂ
-#include <regex>			// K\
+#include <array>			// Œ蒷z
+#include <algorithm>		// std::all_ofƂ
+#include <thread>			// ǂݍ
+#include <atomic>			// ǂݍ݂̊蓖
+#include <mutex>			// t@C̔r
+#include <memory>			// ͌ʂ̋L
+#include <memory_resource>	// ͌ʂ̃A[im
 #include <charconv>			// 񐔎ϊ̂
 #include <limits>			// std::numeric_limitŝ
+#include <cstring>			// std::memcmpƂ
+#include <chrono>			// ǂݍݎԂ̌v
+#include <iterator>			// ͈͑̃Ce[^
+#include <exception>		// ̗͂O̎󂯓n
+#include <future>			// t@C̍쐬҂
+
+#if defined(__AVX2__)
+#include <immintrin.h>		// ꊇfR[hEClsn(AVX2)
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>		// ꊇfR[hEClsn(SSE2)
+#endif
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>		// }bv(CreateFileMapping)
+#else
+#include <fcntl.h>			// open
+#include <sys/mman.h>		// }bv(mmap)
+#include <unistd.h>			// close
+#endif
 
 namespace SAELib {
 	namespace ReadAirFile_detail {
@@ -28,6 +60,8 @@ namespace SAELib {
 		namespace AIRFormat {
 			inline constexpr std::string_view kExtension = ".air";
 			inline constexpr ksize_t kFileSizeLimit = 0xffffffff;
+			inline constexpr std::string_view kCacheExtension = ".saecache";
+			inline constexpr char kCacheMagic[8] = { 'S', 'A', 'E', 'A', 'I', 'R', 'C', '\3' }; // ̓LbV`̔Ő
 		};
 
 		struct T_Bit {
@@ -55,7 +89,7 @@ namespace SAELib {
 			inline static constexpr T_Bit kDummySpriteGroupNo = T_Bit(29, 1);
 			inline static constexpr T_Bit kDummySpriteImageNo = T_Bit(30, 1);
 			inline static constexpr T_Bit kElemLoopStart = T_Bit(0, 2147483647);
-			inline static constexpr T_Bit kExistLoopStart = T_Bit(32, 1);
+			inline static constexpr T_Bit kExistLoopStart = T_Bit(31, 1);
 
 		public:
 			[[nodiscard]] inline static constexpr int32_t EncodeSpriteNumber(int32_t GroupNo, int32_t ImageNo) noexcept {
@@ -102,12 +136,13 @@ namespace SAELib {
 			inline constexpr T_CheckRange kElemAlpha = T_CheckRange(0, 256);
 		}
 		
+		// ǂݍݎ̐ݒ(ύX̂тɕčւAǂݍ݁EAIRf[^͎擾_̎ʂێ)
 		struct T_Config {
-		private:
+		public:
 			T_Config() = default;
 			~T_Config() = default;
-			T_Config(const T_Config&) = delete;
-			T_Config& operator=(const T_Config&) = delete;
+			T_Config(const T_Config&) = default;
+			T_Config& operator=(const T_Config&) = default;
 
 		private:
 			int32_t BitFlag_ = {};
@@ -115,15 +150,38 @@ namespace SAELib {
 			// &1 = ̃CuO𓊂邩
 			// &2 = G[Ot@C𐶐邩
 			// &4 = SAELibt@C쐬邩
-			// &8 = 
+			// &8 = AIRt@C}bvœǂݍނ
+			// &16 = AIRt@CɃt@Cgp邩
+			// &32 = t@CXVŌ؂邩
+			// &64 = ͍ς݃f[^̃LbVt@Cgp邩
+			// &128 = AIRt@C̉͌ʂ𕡐AIRŋL邩
+			// &256 = ͌ʂ1̃̈(A[i)ɂ܂Ƃ߂Ċmۂ邩
+			// &512 = Aj̗vfŏ̎QƎɉ͂邩
+			// &1024 = XvCgԍAjEvf쐬邩
+			// &2048 = e̗vf1ɂ܂Ƃ߂ĕێ邩
+			// &4096 = l͈̔͂t@C̗vf`ŕێ邩
+			// &8192 = 
 			// 
 			// SAELibt@C̐pXw
 			// AIRf[^JnfBNgpXw
+			// Ajԍ̒ڎQƃe[u쐬閧x(%)
+			// A[i̊mی
+			// 1t@C̉͂ɎgpXbh
 			// 
 
 			inline static constexpr int32_t kThrowError = 1 << 0;
 			inline static constexpr int32_t kCreateLogFile = 1 << 1;
 			inline static constexpr int32_t kCreateSAELibFile = 1 << 2;
+			inline static constexpr int32_t kUseMappedFile = 1 << 3;
+			inline static constexpr int32_t kUseFileIndex = 1 << 4;
+			inline static constexpr int32_t kCheckFileIndexTime = 1 << 5;
+			inline static constexpr int32_t kUseBinaryCache = 1 << 6;
+			inline static constexpr int32_t kUseSharedData = 1 << 7;
+			inline static constexpr int32_t kUseArena = 1 << 8;
+			inline static constexpr int32_t kUseLazyParse = 1 << 9;
+			inline static constexpr int32_t kUseSpriteIndex = 1 << 10;
+			inline static constexpr int32_t kUseElemPool = 1 << 11;
+			inline static constexpr int32_t kUseNarrowElem = 1 << 12;
 			inline static constexpr int32_t kDefaultConfig = 0;
 
 			// SAELibt@C̃pX
@@ -132,26 +190,83 @@ namespace SAELib {
 			// AIRt@CJnpX
 			std::filesystem::path AIRSearchPath_ = {};
 
-		public:
-			[[nodiscard]] static T_Config& Instance() {
-				static T_Config instance;
+			// Ajԍ̒ڎQƃe[u쐬閧x(Aj / Ajԍ͈̔ ̕S)
+			inline static constexpr int32_t kDefaultDenseIndexDensity = 25;
+			int32_t DenseIndexDensity_ = kDefaultDenseIndexDensity;
+
+			// A[i̊mی(nullptȑꍇnew/delete)
+			std::pmr::memory_resource* ArenaResource_ = nullptr;
+
+			// 1t@C̉͂ɎgpXbh(1 = 񉻂ȂA0 = n[hEFA̓s)
+			inline static constexpr int32_t kDefaultParseThreadCount = 1;
+			int32_t ParseThreadCount_ = kDefaultParseThreadCount;
+
+			// vZXʂ݂̌̐ݒ(Mutex()Ŕrčւ)
+			[[nodiscard]] static std::shared_ptr<const T_Config>& Current() {
+				static std::shared_ptr<const T_Config> instance = std::make_shared<const T_Config>();
+				return instance;
+			}
+			[[nodiscard]] static std::mutex& Mutex() {
+				static std::mutex instance;
 				return instance;
 			}
 
+		public:
+			// ݂̐ݒ̎ʂ擾(擾̐ݒύX̉e󂯂Ȃ)
+			[[nodiscard]] static std::shared_ptr<const T_Config> Snapshot() {
+				std::lock_guard<std::mutex> Lock(Mutex());
+				return Current();
+			}
+
+			// ݂̐ݒ𕡐ĕύXAւ(擾ς݂̎ʂ͕ύXȂ)
+			template <class T_Func>
+			static void Update(T_Func&& Func) {
+				std::lock_guard<std::mutex> Lock(Mutex());
+				std::shared_ptr<T_Config> Next = std::make_shared<T_Config>(*Current());
+				Func(*Next);
+				Current() = std::move(Next);
+			}
+
 		public:
 			[[nodiscard]] int32_t BitFlag() const noexcept { return BitFlag_; }
 			[[nodiscard]] bool ThrowError() const noexcept { return (BitFlag_ & kThrowError) != 0; }
 			[[nodiscard]] bool CreateLogFile() const noexcept { return (BitFlag_ & kCreateLogFile) != 0; }
 			[[nodiscard]] bool CreateSAELibFile() const noexcept { return (BitFlag_ & kCreateSAELibFile) != 0; }
+			[[nodiscard]] bool UseMappedFile() const noexcept { return (BitFlag_ & kUseMappedFile) != 0; }
+			[[nodiscard]] bool UseFileIndex() const noexcept { return (BitFlag_ & kUseFileIndex) != 0; }
+			[[nodiscard]] bool CheckFileIndexTime() const noexcept { return (BitFlag_ & kCheckFileIndexTime) != 0; }
+			[[nodiscard]] bool UseBinaryCache() const noexcept { return (BitFlag_ & kUseBinaryCache) != 0; }
+			[[nodiscard]] bool UseSharedData() const noexcept { return (BitFlag_ & kUseSharedData) != 0; }
+			[[nodiscard]] bool UseArena() const noexcept { return (BitFlag_ & kUseArena) != 0; }
+			[[nodiscard]] bool UseLazyParse() const noexcept { return (BitFlag_ & kUseLazyParse) != 0; }
+			[[nodiscard]] bool UseSpriteIndex() const noexcept { return (BitFlag_ & kUseSpriteIndex) != 0; }
+			[[nodiscard]] bool UseElemPool() const noexcept { return (BitFlag_ & kUseElemPool) != 0; }
+			[[nodiscard]] bool UseNarrowElem() const noexcept { return (BitFlag_ & kUseNarrowElem) != 0; }
 			[[nodiscard]] const std::filesystem::path& SAELibFilePath() const noexcept { return SAELibFilePath_; }
 			[[nodiscard]] const std::filesystem::path& AIRSearchPath() const noexcept { return AIRSearchPath_; }
+			[[nodiscard]] int32_t DenseIndexDensity() const noexcept { return DenseIndexDensity_; }
+			[[nodiscard]] std::pmr::memory_resource* ArenaResource() const noexcept { return ArenaResource_ ? ArenaResource_ : std::pmr::new_delete_resource(); }
+			[[nodiscard]] int32_t ParseThreadCount() const noexcept { return ParseThreadCount_; }
 
 			void InitConfig() { BitFlag_ = kDefaultConfig; }
 			void ThrowError(bool flag) { BitFlag_ = (BitFlag_ & ~kThrowError) | (flag ? kThrowError : 0); }
 			void CreateLogFile(bool flag) { BitFlag_ = (BitFlag_ & ~kCreateLogFile) | (flag ? kCreateLogFile : 0); }
 			void CreateSAELibFile(bool flag) { BitFlag_ = (BitFlag_ & ~kCreateSAELibFile) | (flag ? kCreateSAELibFile : 0); }
+			void UseMappedFile(bool flag) { BitFlag_ = (BitFlag_ & ~kUseMappedFile) | (flag ? kUseMappedFile : 0); }
+			void UseFileIndex(bool flag) { BitFlag_ = (BitFlag_ & ~kUseFileIndex) | (flag ? kUseFileIndex : 0); }
+			void CheckFileIndexTime(bool flag) { BitFlag_ = (BitFlag_ & ~kCheckFileIndexTime) | (flag ? kCheckFileIndexTime : 0); }
+			void UseBinaryCache(bool flag) { BitFlag_ = (BitFlag_ & ~kUseBinaryCache) | (flag ? kUseBinaryCache : 0); }
+			void UseSharedData(bool flag) { BitFlag_ = (BitFlag_ & ~kUseSharedData) | (flag ? kUseSharedData : 0); }
+			void UseArena(bool flag) { BitFlag_ = (BitFlag_ & ~kUseArena) | (flag ? kUseArena : 0); }
+			void UseLazyParse(bool flag) { BitFlag_ = (BitFlag_ & ~kUseLazyParse) | (flag ? kUseLazyParse : 0); }
+			void UseSpriteIndex(bool flag) { BitFlag_ = (BitFlag_ & ~kUseSpriteIndex) | (flag ? kUseSpriteIndex : 0); }
+			void UseElemPool(bool flag) { BitFlag_ = (BitFlag_ & ~kUseElemPool) | (flag ? kUseElemPool : 0); }
+			void UseNarrowElem(bool flag) { BitFlag_ = (BitFlag_ & ~kUseNarrowElem) | (flag ? kUseNarrowElem : 0); }
 			void SAELibFilePath(const std::filesystem::path& Path) { SAELibFilePath_ = (Path.empty() ? std::filesystem::current_path() : Path); }
 			void AIRSearchPath(const std::filesystem::path& Path) { AIRSearchPath_ = (Path.empty() ? std::filesystem::current_path() : Path); }
+			void DenseIndexDensity(int32_t Density) { DenseIndexDensity_ = std::clamp(Density, 0, 101); }
+			void ArenaResource(std::pmr::memory_resource* Resource) noexcept { ArenaResource_ = Resource; }
+			void ParseThreadCount(int32_t Count) noexcept { ParseThreadCount_ = std::max(Count, 0); }
 		};
 
 
@@ -285,13 +400,7 @@ namespace SAELib {
 		}
 
 		struct T_ErrorHandle {
-		private:
-			T_ErrorHandle() = default;
-			~T_ErrorHandle() = default;
-			T_ErrorHandle(const T_ErrorHandle&) = delete;
-			T_ErrorHandle& operator=(const T_ErrorHandle&) = delete;
-
-		private:
+		public:
 			struct T_ErrorList {
 			private:
 				const int32_t kErrorID;
@@ -309,27 +418,71 @@ namespace SAELib {
 				T_ErrorList(int32_t ErrorID, int32_t ErrorValue) : kErrorID(ErrorID), kErrorValue(ErrorValue) {}
 				T_ErrorList(int32_t ErrorID, int32_t ErrorValue, int32_t ErrorLine) : kErrorID(ErrorID), kErrorValue(ErrorValue), kErrorLine(ErrorLine) {}
 			};
+
+		private:
 			std::vector<T_ErrorList> ErrorList = {};
+			T_ErrorHandle* Shared_ = nullptr;	// L^(vZXʂ̃G[ꗗ֋L^ꍇ̂)
+			bool ThrowError_ = false;			// L^ɗO𓊂邩(ǂݍݎ̐ݒ̎ʂ)
+			size_t NumError_ = 0;				// ̃nhL^G[
+
+			// ʂ̃G[ꗗ͕̓ǂݍ݂瓯ɋL^邽ߔr
+			[[nodiscard]] static std::mutex& SharedMutex() {
+				static std::mutex Mutex;
+				return Mutex;
+			}
+
+			template <class... T_Args>
+			void Record(T_Args... Args) {
+				++NumError_;
+				if (!Shared_) {
+					ErrorList.emplace_back(Args...);
+					return;
+				}
+				std::lock_guard<std::mutex> Lock(SharedMutex());
+				Shared_->ErrorList.emplace_back(Args...);
+			}
 
-			void InitErrorList() { ErrorList.clear(); }
+			// L^̃G[ꗗ̎ʂ(ʂ̈ꗗ͔rĕ)
+			[[nodiscard]] std::vector<T_ErrorList> CopyList() const {
+				if (!Shared_) { return ErrorList; }
+				std::lock_guard<std::mutex> Lock(SharedMutex());
+				return Shared_->ErrorList;
+			}
 
 		public:
+			// ̃G[L^(vZX)
 			[[nodiscard]] static T_ErrorHandle& Instance() {
 				static T_ErrorHandle instance;
 				return instance;
 			}
 
 		public:
-			void AddErrorList(int32_t ErrorID) { ErrorList.emplace_back(T_ErrorList(ErrorID)); }
-			void AddErrorList(int32_t ErrorID, int32_t ErrorValue) { ErrorList.emplace_back(T_ErrorList(ErrorID, ErrorValue)); }
-			void AddErrorList(int32_t ErrorID, int32_t ErrorValue, int32_t ErrorLine) { ErrorList.emplace_back(T_ErrorList(ErrorID, ErrorValue, ErrorLine)); }
+			// gɋL^G[ꗗ(ʂ̈ꗗ֋L^ꍇ͋)
+			[[nodiscard]] const std::vector<T_ErrorList>& ErrorLists() const noexcept { return ErrorList; }
+			// ̃nhL^G[(L^ɂ炸)
+			[[nodiscard]] size_t NumError() const noexcept { return NumError_; }
+			[[nodiscard]] bool IsThrowError() const noexcept { return ThrowError_; }
+			void InitErrorList() {
+				NumError_ = 0;
+				if (!Shared_) {
+					ErrorList.clear();
+					return;
+				}
+				std::lock_guard<std::mutex> Lock(SharedMutex());
+				Shared_->ErrorList.clear();
+			}
+
+		public:
+			void AddErrorList(int32_t ErrorID) { Record(ErrorID); }
+			void AddErrorList(int32_t ErrorID, int32_t ErrorValue) { Record(ErrorID, ErrorValue); }
+			void AddErrorList(int32_t ErrorID, int32_t ErrorValue, int32_t ErrorLine) { Record(ErrorID, ErrorValue, ErrorLine); }
 
-			[[noreturn]] void ThrowError(int32_t ErrorID) const { throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name); }
-			[[noreturn]] void ThrowError(int32_t ErrorID, int32_t ErrorValue) const { throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name); }
-			[[noreturn]] void ThrowError(int32_t ErrorID, int32_t ErrorValue, int32_t ErrorLine) const { throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name); }
+			[[noreturn]] static void ThrowError(int32_t ErrorID) { throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name); }
+			[[noreturn]] static void ThrowError(int32_t ErrorID, int32_t ErrorValue) { throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name); }
+			[[noreturn]] static void ThrowError(int32_t ErrorID, int32_t ErrorValue, int32_t ErrorLine) { throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name); }
 
 			void SetError(int32_t ErrorID) {
-				if (!T_Config::Instance().ThrowError()) {
+				if (!ThrowError_) {
 					AddErrorList(ErrorID);
 					return;
 				}
@@ -337,7 +490,7 @@ namespace SAELib {
 			}
 
 			void SetError(int32_t ErrorID, int32_t ErrorValue) {
-				if (!T_Config::Instance().ThrowError()) {
+				if (!ThrowError_) {
 					AddErrorList(ErrorID, ErrorValue);
 					return;
 				}
@@ -345,18 +498,26 @@ namespace SAELib {
 			}
 
 			void SetError(int32_t ErrorID, int32_t ErrorValue, int32_t ErrorLine) {
-				if (!T_Config::Instance().ThrowError()) {
+				if (!ThrowError_) {
 					AddErrorList(ErrorID, ErrorValue, ErrorLine);
 					return;
 				}
 				ThrowError(ErrorID, ErrorValue, ErrorLine);
 			}
 
+			// ʂ̃nhɋL^G[𓯂ԂŋL^(O𓊂ݒ̏ꍇ͍ŏ̃G[œ)
+			void ReplayError(const std::vector<T_ErrorList>& List) {
+				for (const auto& Error : List) {
+					SetError(Error.ErrorID(), Error.ErrorValue(), Error.ErrorLine());
+				}
+			}
+
 			void WriteErrorLog(std::ofstream& File) {
+				const std::vector<T_ErrorList> List = CopyList();
 				File << "ReadAirFile ErrorLog" << "\n";
-				File << "G[: " << ErrorList.size() << "\n";
+				File << "G[: " << List.size() << "\n";
 
-				for (auto& Error : ErrorList) {
+				for (auto& Error : List) {
 					File << "\nG[: " << Error.ErrorName() << "\n";
 					File << "G[e: " << Error.ErrorMessage() << "\n";
 					if (Error.ErrorID() == ErrorMessage::AnimNumberOutOfRange ||
@@ -381,17 +542,25 @@ namespace SAELib {
 				File.flush();
 
 				if (File.fail() || File.bad()) {
-					if (T_Config::Instance().ThrowError()) {
+					if (ThrowError_) {
 						ThrowError(ErrorMessage::WriteErrorLogFileFailed);
 					}
 				}
 				File.close();
 				if (File.fail() || File.bad()) {
-					if (T_Config::Instance().ThrowError()) {
+					if (ThrowError_) {
 						ThrowError(ErrorMessage::CloseErrorLogFileFailed);
 					}
 				}
 			}
+
+		public:
+			// O𓊂Ɏg֋L^
+			T_ErrorHandle() = default;
+			// g֋L^AThrowErrortruȅꍇ͗O𓊂
+			explicit T_ErrorHandle(bool ThrowError) : ThrowError_(ThrowError) {}
+			// Shared̃G[ꗗ֋L^AConfig̐ݒɉėO𓊂
+			T_ErrorHandle(T_ErrorHandle& Shared, const T_Config& Config) : Shared_(&Shared), ThrowError_(Config.ThrowError()) {}
 		};
 
 		// pX̕⏕
@@ -417,6 +586,13 @@ namespace SAELib {
 
 			}
 
+			// XV(擾łȂꍇ 0)
+			[[nodiscard]] static int64_t LastWriteTime(const std::filesystem::path& Path) {
+				std::error_code ErrorCode = {};
+				const auto FileTime = std::filesystem::last_write_time(Path, ErrorCode);
+				return ErrorCode ? 0 : static_cast<int64_t>(FileTime.time_since_epoch().count());
+			}
+
 		public:
 			T_FilePathSystem() = default;
 
@@ -427,37 +603,550 @@ namespace SAELib {
 			[[nodiscard]] bool empty() const noexcept { return Path_.empty(); }
 		};
 
+		// AIRt@Cp̃t@C(JnpXƂ1xčėp)
+		struct T_FileIndex {
+		private:
+			T_FileIndex() = default;
+			~T_FileIndex() = default;
+			T_FileIndex(const T_FileIndex&) = delete;
+			T_FileIndex& operator=(const T_FileIndex&) = delete;
+
+		private:
+			struct T_DirectoryIndex {
+				std::unordered_map<std::string, std::string> FilePath = {};	// t@C  ŏɌpX
+				std::vector<std::pair<std::filesystem::path, std::filesystem::file_time_type>> DirectoryTime = {};
+			};
+
+			using T_IndexPtr = std::shared_ptr<const T_DirectoryIndex>;
+			struct T_Entry {
+				std::shared_future<T_IndexPtr> Index = {};	// 쐬̏ꍇ͊܂ő҂
+				uint64_t Serial = 0;						// o^Ƃ̔ԍ(쐬Ɏso^̂ݎ菜)
+			};
+
+			std::mutex Mutex_ = {};
+			std::unordered_map<std::string, T_Entry> IndexList_ = {};	// JnpX  
+			uint64_t NextSerial_ = 0;
+
+			[[nodiscard]] static T_DirectoryIndex Build(const std::filesystem::path& RootPath) {
+				T_DirectoryIndex DirectoryIndex = {};
+				std::error_code ErrorCode = {};
+				DirectoryIndex.DirectoryTime.emplace_back(RootPath, std::filesystem::last_write_time(RootPath, ErrorCode));
+
+				for (const auto& entry : std::filesystem::recursive_directory_iterator(
+					RootPath, std::filesystem::directory_options::skip_permission_denied)) {
+					if (entry.is_directory()) {
+						DirectoryIndex.DirectoryTime.emplace_back(entry.path(), entry.last_write_time(ErrorCode));
+						continue;
+					}
+					if (!entry.is_regular_file()) { continue; }
+					DirectoryIndex.FilePath.try_emplace(entry.path().filename().string(), entry.path().string());
+				}
+				return DirectoryIndex;
+			}
+
+			// 쐬ɃfBNgeω
+			[[nodiscard]] static bool IsModified(const T_DirectoryIndex& DirectoryIndex) {
+				std::error_code ErrorCode = {};
+				for (const auto& [Path, Time] : DirectoryIndex.DirectoryTime) {
+					if (std::filesystem::last_write_time(Path, ErrorCode) != Time || ErrorCode) { return true; }
+				}
+				return false;
+			}
+
+			// 擾(o^̏ꍇAStaleƓo^Ăꍇ͍쐬)
+			// 쐬(fBNg)͔r1̌Ăяô݂sAJnpX̑̌Ăяo͊҂
+			// ɗOꍇ͓o^A҂ĂĂяoɂO𓊂
+			[[nodiscard]] T_IndexPtr Acquire(const std::filesystem::path& RootPath, const T_IndexPtr& Stale) {
+				const std::string Key = RootPath.string();
+				std::promise<T_IndexPtr> Promise = {};
+				std::shared_future<T_IndexPtr> Index = {};
+				uint64_t Serial = 0;
+				{
+					std::lock_guard<std::mutex> Lock(Mutex_);
+					T_Entry& Entry = IndexList_[Key];
+					const bool Ready = Entry.Index.valid() && Entry.Index.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+					if (Entry.Index.valid() && !(Stale && Ready && Entry.Index.get() == Stale)) { Index = Entry.Index; }
+					else {
+						Entry.Index = Promise.get_future().share();
+						Entry.Serial = Serial = ++NextSerial_;
+					}
+				}
+				if (Index.valid()) { return Index.get(); }
+
+				try {
+					T_IndexPtr DirectoryIndex = std::make_shared<const T_DirectoryIndex>(Build(RootPath));
+					Promise.set_value(DirectoryIndex);
+					return DirectoryIndex;
+				}
+				catch (...) {
+					Promise.set_exception(std::current_exception());
+					std::lock_guard<std::mutex> Lock(Mutex_);
+					if (const auto it = IndexList_.find(Key); it != IndexList_.end() && it->second.Serial == Serial) { IndexList_.erase(it); }
+					throw;
+				}
+			}
+
+		public:
+			[[nodiscard]] static T_FileIndex& Instance() {
+				static T_FileIndex instance;
+				return instance;
+			}
+
+		public:
+			// Ȃꍇ͋󕶎
+			// XVEt@C݂̑̊mF͔rɍsA̍蒼͓JnpXɂ1x̂ݍs
+			[[nodiscard]] std::string Find(const std::filesystem::path& RootPath, const std::string& FileName, bool CheckTime) {
+				T_IndexPtr Index = Acquire(RootPath, nullptr);
+				if (CheckTime && IsModified(*Index)) { Index = Acquire(RootPath, Index); }
+
+				auto Found = Index->FilePath.find(FileName);
+				if (Found == Index->FilePath.end()) { return {}; }
+				if (std::filesystem::exists(Found->second)) { return Found->second; }
+
+				// 쐬ɍ폜Eړꂽt@C͍蒼ĒT
+				Index = Acquire(RootPath, Index);
+				Found = Index->FilePath.find(FileName);
+				return Found != Index->FilePath.end() ? Found->second : std::string();
+			}
+
+			void Refresh(const std::filesystem::path& RootPath) {
+				std::promise<T_IndexPtr> Promise = {};
+				Promise.set_value(std::make_shared<const T_DirectoryIndex>(Build(RootPath)));
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				IndexList_[RootPath.string()] = { Promise.get_future().share(), ++NextSerial_ };
+			}
+
+			void clear() {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				IndexList_.clear();
+			}
+		};
+
+		// t@C̓ǂݎp}bsO
+		struct T_MappedFile {
+		private:
+			const char* Data_ = nullptr;
+			size_t Size_ = 0;
+			bool IsOpen_ = false;
+#ifdef _WIN32
+			HANDLE FileHandle_ = INVALID_HANDLE_VALUE;
+			HANDLE MappingHandle_ = nullptr;
+#endif
+
+		public:
+			[[nodiscard]] std::string_view View() const noexcept { return std::string_view(Data_, Size_); }
+			[[nodiscard]] bool is_open() const noexcept { return IsOpen_; }
+
+			[[nodiscard]] bool Map(const std::filesystem::path& Path, size_t Size) {
+				Unmap();
+#ifdef _WIN32
+				FileHandle_ = CreateFileW(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+				if (FileHandle_ == INVALID_HANDLE_VALUE) { return false; }
+				if (Size) {
+					MappingHandle_ = CreateFileMappingW(FileHandle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+					if (!MappingHandle_) { Unmap(); return false; }
+					Data_ = static_cast<const char*>(MapViewOfFile(MappingHandle_, FILE_MAP_READ, 0, 0, Size));
+					if (!Data_) { Unmap(); return false; }
+				}
+#else
+				const int FileDescriptor = ::open(Path.c_str(), O_RDONLY);
+				if (FileDescriptor < 0) { return false; }
+				if (Size) {
+					void* const Address = ::mmap(nullptr, Size, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+					if (Address == MAP_FAILED) { ::close(FileDescriptor); return false; }
+					::madvise(Address, Size, MADV_SEQUENTIAL);
+					Data_ = static_cast<const char*>(Address);
+				}
+				::close(FileDescriptor);
+#endif
+				Size_ = Size;
+				IsOpen_ = true;
+				return true;
+			}
+
+			void Unmap() noexcept {
+#ifdef _WIN32
+				if (Data_) { UnmapViewOfFile(Data_); }
+				if (MappingHandle_) { CloseHandle(MappingHandle_); }
+				if (FileHandle_ != INVALID_HANDLE_VALUE) { CloseHandle(FileHandle_); }
+				MappingHandle_ = nullptr;
+				FileHandle_ = INVALID_HANDLE_VALUE;
+#else
+				if (Data_) { ::munmap(const_cast<char*>(Data_), Size_); }
+#endif
+				Data_ = nullptr;
+				Size_ = 0;
+				IsOpen_ = false;
+			}
+
+		public:
+			T_MappedFile() = default;
+			~T_MappedFile() { Unmap(); }
+			T_MappedFile(const T_MappedFile&) = delete;
+			T_MappedFile& operator=(const T_MappedFile&) = delete;
+		};
+
 		// AjXg̃Ajԍ̏d`FbN݊mF
-		struct T_UnorderedMap {
+		// Ajԍ̎̓RpCɑI
+		//   SAELIB_AIR_INDEX_SORTED : \[gςݔz(Ȃ񕪒T)
+		//   SAELIB_AIR_INDEX_FLAT   : I[vAhX@̃nbVe[u
+		//   `                   : std::unordered_map
+		// o^l̓Ajԍ̓o^(AnimList̓Y)
+
+		// \[gςݔz
+		struct T_SortedIndex {
 		private:
-			std::unordered_map<int32_t, int32_t> UnorderedMap = {};
+			std::pmr::vector<int32_t> Key_ = {};
+			std::pmr::vector<int32_t> Value_ = {};
+
+			// valueȉōő̃L[ʒu(Ȃ)
+			[[nodiscard]] size_t LowerIndex(int32_t value) const noexcept {
+				const int32_t* Base = Key_.data();
+				size_t Size = Key_.size();
+				while (Size > 1) {
+					const size_t Half = Size / 2;
+					Base = (Base[Half] <= value) ? Base + Half : Base;
+					Size -= Half;
+				}
+				return static_cast<size_t>(Base - Key_.data());
+			}
 
 		public:
+			T_SortedIndex() = default;
+			explicit T_SortedIndex(std::pmr::memory_resource* Resource) : Key_(Resource), Value_(Resource) {}
+			T_SortedIndex(const T_SortedIndex& Source, std::pmr::memory_resource* Resource) : Key_(Source.Key_, Resource), Value_(Source.Value_, Resource) {}
+
 			void Register(int32_t value) {
-				UnorderedMap[value] = static_cast<int32_t>(UnorderedMap.size());
+				const int32_t Index = static_cast<int32_t>(Key_.size());
+				// AIRt@C̃Ajԍ͂قڏɕԂߖǉ唼
+				if (Key_.empty() || Key_.back() < value) {
+					Key_.push_back(value);
+					Value_.push_back(Index);
+					return;
+				}
+				const auto Pos = std::lower_bound(Key_.begin(), Key_.end(), value);
+				if (Pos != Key_.end() && *Pos == value) { return; }
+				Value_.insert(Value_.begin() + (Pos - Key_.begin()), Index);
+				Key_.insert(Pos, value);
+			}
+
+			void reserve(ksize_t value) { Key_.reserve(value); Value_.reserve(value); }
+			void clear() noexcept { Key_.clear(); Value_.clear(); }
+			void shrink_to_fit() { Key_.shrink_to_fit(); Value_.shrink_to_fit(); }
+
+			[[nodiscard]] int32_t find(int32_t input) const noexcept {
+				if (Key_.empty()) { return -1; }
+				const size_t Index = LowerIndex(input);
+				return Key_[Index] == input ? Value_[Index] : -1;
+			}
+
+			[[nodiscard]] size_t size() const noexcept { return Key_.size(); }
+			[[nodiscard]] size_t MemorySize() const noexcept { return (Key_.capacity() + Value_.capacity()) * sizeof(int32_t); }
+			[[nodiscard]] size_t DataSize() const noexcept { return (Key_.size() + Value_.size()) * sizeof(int32_t); }
+
+			template<class Func>
+			void ForEach(Func&& Function) const {
+				for (size_t i = 0; i < Key_.size(); ++i) { Function(Key_[i], Value_[i]); }
+			}
+		};
+
+		// I[vAhX@(`T)̃nbVe[uAAjԍ0ȏȂ̂ŕ󂫂ƂĈ
+		struct T_FlatIndex {
+		private:
+			struct T_Slot {
+				int32_t Key;
+				int32_t Value;
+			};
+			static constexpr int32_t kEmptyKey = -1;
+			static constexpr size_t kMinCapacity = 16;
+
+			std::pmr::vector<T_Slot> Slot_ = {};
+			size_t Size_ = 0;
+
+			[[nodiscard]] static size_t Hash(int32_t value) noexcept {
+				return static_cast<size_t>(static_cast<uint32_t>(value) * 0x9E3779B1u);
+			}
+			[[nodiscard]] size_t SlotIndex(int32_t value) const noexcept {
+				const size_t Mask = Slot_.size() - 1;
+				size_t Index = Hash(value) & Mask;
+				while (Slot_[Index].Key != kEmptyKey && Slot_[Index].Key != value) {
+					Index = (Index + 1) & Mask;
+				}
+				return Index;
+			}
+			void Rehash(size_t Capacity) {
+				std::pmr::vector<T_Slot> OldSlot(Capacity, T_Slot{ kEmptyKey, -1 }, Slot_.get_allocator());
+				OldSlot.swap(Slot_);
+				for (const auto& Slot : OldSlot) {
+					if (Slot.Key != kEmptyKey) { Slot_[SlotIndex(Slot.Key)] = Slot; }
+				}
+			}
+			[[nodiscard]] static size_t CapacityFor(size_t Size) noexcept {
+				size_t Capacity = kMinCapacity;
+				while (Capacity < Size * 2) { Capacity *= 2; }
+				return Capacity;
 			}
 
 		public:
-			T_UnorderedMap() = default;
+			T_FlatIndex() = default;
+			explicit T_FlatIndex(std::pmr::memory_resource* Resource) : Slot_(Resource) {}
+			T_FlatIndex(const T_FlatIndex& Source, std::pmr::memory_resource* Resource) : Slot_(Source.Slot_, Resource), Size_(Source.Size_) {}
+
+			void Register(int32_t value) {
+				if (value < 0) { return; }
+				if ((Size_ + 1) * 2 > Slot_.size()) { Rehash(CapacityFor(Size_ + 1)); }
+				T_Slot& Slot = Slot_[SlotIndex(value)];
+				if (Slot.Key == value) { return; }
+				Slot = T_Slot{ value, static_cast<int32_t>(Size_++) };
+			}
+
+			void reserve(ksize_t value) { if (CapacityFor(value) > Slot_.size()) { Rehash(CapacityFor(value)); } }
+			void clear() noexcept { Slot_.clear(); Size_ = 0; }
+			void shrink_to_fit() {
+				if (Size_ == 0) { Slot_.clear(); Slot_.shrink_to_fit(); return; }
+				if (CapacityFor(Size_) < Slot_.size()) { Rehash(CapacityFor(Size_)); }
+			}
+
+			[[nodiscard]] int32_t find(int32_t input) const noexcept {
+				if (Slot_.empty() || input < 0) { return -1; }
+				const T_Slot& Slot = Slot_[SlotIndex(input)];
+				return Slot.Key == input ? Slot.Value : -1;
+			}
+
+			[[nodiscard]] size_t size() const noexcept { return Size_; }
+			[[nodiscard]] size_t MemorySize() const noexcept { return Slot_.capacity() * sizeof(T_Slot); }
+			[[nodiscard]] size_t DataSize() const noexcept { return Slot_.size() * sizeof(T_Slot); }
+
+			template<class Func>
+			void ForEach(Func&& Function) const {
+				for (const auto& Slot : Slot_) {
+					if (Slot.Key != kEmptyKey) { Function(Slot.Key, Slot.Value); }
+				}
+			}
+		};
+
+		// std::unordered_map
+		struct T_StdIndex {
+		private:
+			std::pmr::unordered_map<int32_t, int32_t> UnorderedMap = {};
+
+		public:
+			T_StdIndex() = default;
+			explicit T_StdIndex(std::pmr::memory_resource* Resource) : UnorderedMap(Resource) {}
+			T_StdIndex(const T_StdIndex& Source, std::pmr::memory_resource* Resource) : UnorderedMap(Source.UnorderedMap, Resource) {}
+
+			void Register(int32_t value) { UnorderedMap.try_emplace(value, static_cast<int32_t>(UnorderedMap.size())); }
 
 			void reserve(ksize_t value) { UnorderedMap.reserve(value); }
-			void clear() { UnorderedMap.clear(); }
+			void clear() noexcept { UnorderedMap.clear(); }
 			void shrink_to_fit() { UnorderedMap.rehash(0); }
-		
-			[[nodiscard]] int32_t find(int32_t input) {
+
+			[[nodiscard]] int32_t find(int32_t input) const {
 				auto it = UnorderedMap.find(input);
 				if (it != UnorderedMap.end()) { return it->second; }
 				return -1;
 			}
 
-			[[nodiscard]] bool exist(int32_t value) { return find(value) >= 0; }
-			[[nodiscard]] bool empty() const noexcept { return UnorderedMap.empty(); }
-			[[nodiscard]] ksize_t size() const noexcept { return static_cast<ksize_t>(UnorderedMap.size()); }
+			[[nodiscard]] size_t size() const noexcept { return UnorderedMap.size(); }
+			// m[hƃoPbgz̊TZ
+			[[nodiscard]] size_t MemorySize() const noexcept {
+				return UnorderedMap.size() * (sizeof(std::pair<const int32_t, int32_t>) + sizeof(void*) * 2) + UnorderedMap.bucket_count() * sizeof(void*);
+			}
+			[[nodiscard]] size_t DataSize() const noexcept { return MemorySize(); }
+
+			template<class Func>
+			void ForEach(Func&& Function) const {
+				for (const auto& [Key, Value] : UnorderedMap) { Function(Key, Value); }
+			}
+		};
+
+#if defined(SAELIB_AIR_INDEX_SORTED)
+		using T_AnimIndex = T_SortedIndex;
+#elif defined(SAELIB_AIR_INDEX_FLAT)
+		using T_AnimIndex = T_FlatIndex;
+#else
+		using T_AnimIndex = T_StdIndex;
+#endif
+
+		// Ajԍ  AnimList̓Y
+		struct T_UnorderedMap {
+		private:
+			// ڎQƃe[u̗vf(4MB)
+			inline static constexpr size_t kDenseIndexSizeLimit = size_t(1) << 20;
+
+			T_AnimIndex AnimIndex = {};
+
+			// AjԍWĂꍇ̒ڎQƃe[u(DenseIndex_[Ajԍ - DenseIndexBase_])
+			std::pmr::vector<int32_t> DenseIndex_ = {};
+			int32_t DenseIndexBase_ = 0;
+
+		public:
+			void Register(int32_t value) {
+				DenseIndex_.clear();
+				AnimIndex.Register(value);
+			}
+
+			/**
+			* @brief ڎQƃe[u̍쐬
+			*
+			* @Ajԍ͈̔͂ɑ΂Aj̊Density(%)ȏȂ璼ڎQƃe[u쐬Aȍ~̌̓e[uQƂ܂
+			*
+			* @Density101ȏ̏ꍇ͍쐬܂
+			*
+			* @param int32_t Density 쐬閧x(%)
+			*/
+			void BuildDenseIndex(int32_t Density) {
+				DenseIndex_.clear();
+				DenseIndex_.shrink_to_fit();
+				if (AnimIndex.size() == 0 || Density > 100) { return; }
+
+				int32_t MinKey = std::numeric_limits<int32_t>::max();
+				int32_t MaxKey = std::numeric_limits<int32_t>::min();
+				AnimIndex.ForEach([&MinKey, &MaxKey](int32_t Key, int32_t) {
+					MinKey = std::min(MinKey, Key);
+					MaxKey = std::max(MaxKey, Key);
+				});
+				const size_t Range = static_cast<size_t>(static_cast<int64_t>(MaxKey) - MinKey + 1);
+				if (Range > kDenseIndexSizeLimit || AnimIndex.size() * 100 < Range * static_cast<size_t>(Density)) { return; }
+
+				DenseIndex_.assign(Range, -1);
+				DenseIndexBase_ = MinKey;
+				AnimIndex.ForEach([this](int32_t Key, int32_t Value) { DenseIndex_[static_cast<size_t>(Key - DenseIndexBase_)] = Value; });
+			}
+
+		public:
+			T_UnorderedMap() = default;
+			explicit T_UnorderedMap(std::pmr::memory_resource* Resource) : AnimIndex(Resource), DenseIndex_(Resource) {}
+			T_UnorderedMap(const T_UnorderedMap& Source, std::pmr::memory_resource* Resource)
+				: AnimIndex(Source.AnimIndex, Resource), DenseIndex_(Source.DenseIndex_, Resource), DenseIndexBase_(Source.DenseIndexBase_) {
+			}
+
+			void reserve(ksize_t value) { AnimIndex.reserve(value); }
+			void clear() {
+				AnimIndex.clear();
+				DenseIndex_.clear();
+			}
+			void shrink_to_fit() {
+				AnimIndex.shrink_to_fit();
+				DenseIndex_.shrink_to_fit();
+			}
+
+			[[nodiscard]] int32_t find(int32_t input) const {
+				if (!DenseIndex_.empty()) {
+					const uint32_t Offset = static_cast<uint32_t>(input) - static_cast<uint32_t>(DenseIndexBase_);
+					return Offset < DenseIndex_.size() ? DenseIndex_[Offset] : -1;
+				}
+				return AnimIndex.find(input);
+			}
+
+			[[nodiscard]] bool exist(int32_t value) const { return find(value) >= 0; }
+			[[nodiscard]] bool empty() const noexcept { return AnimIndex.size() == 0; }
+			[[nodiscard]] ksize_t size() const noexcept { return static_cast<ksize_t>(AnimIndex.size()); }
+			[[nodiscard]] bool IsDenseIndex() const noexcept { return !DenseIndex_.empty(); }
+			[[nodiscard]] size_t MemorySize() const noexcept { return AnimIndex.MemorySize() + DenseIndex_.capacity() * sizeof(int32_t); }
+			[[nodiscard]] size_t DataSize() const noexcept { return AnimIndex.DataSize() + DenseIndex_.size() * sizeof(int32_t); }
+
+			// o^̃Ajԍꗗ
+			[[nodiscard]] std::vector<int32_t> KeyList() const {
+				std::vector<int32_t> KeyList(AnimIndex.size());
+				AnimIndex.ForEach([&KeyList](int32_t Key, int32_t Value) { KeyList[Value] = Key; });
+				return KeyList;
+			}
+		};
+
+		// Elem̃p[^ڂƂ̔zɂ܂Ƃ߂(YAIRf[^ŜElemԍ)
+		struct T_ElemColumns {
+			std::vector<int32_t> GroupNo = {};
+			std::vector<int32_t> ImageNo = {};
+			std::vector<int32_t> PosX = {};
+			std::vector<int32_t> PosY = {};
+			std::vector<int32_t> ElemTime = {};
+			std::vector<int32_t> Facing = {};
+			std::vector<int32_t> VFacing = {};
+			std::vector<int32_t> AlphaA = {};
+			std::vector<int32_t> AlphaS = {};
+			std::vector<int32_t> AlphaD = {};
+
+			void resize(size_t Size) {
+				for (auto* Column : { &GroupNo, &ImageNo, &PosX, &PosY, &ElemTime, &Facing, &VFacing, &AlphaA, &AlphaS, &AlphaD }) {
+					Column->resize(Size);
+				}
+			}
+			[[nodiscard]] size_t size() const noexcept { return GroupNo.size(); }
+		};
+
+		// SpriteNumber/ExtraParam̈ꊇfR[h(AVX2 > SSE2 > XJ[̏ɃRpCɑIAʂT_ElemDatåe擾֐Ɠ)
+		struct T_ElemDecoder {
+		private:
+			static void DecodeScalar(T_ElemColumns& Columns, size_t Begin, size_t End) noexcept {
+				for (size_t i = Begin; i < End; ++i) {
+					const int32_t Sprite = Columns.GroupNo[i];
+					const int32_t Extra = Columns.AlphaD[i];
+					Columns.GroupNo[i] = Convert::DecodeDummySpriteGroupNo(Extra) ? -1 : Convert::DecodeSpriteGroupNo(Sprite);
+					Columns.ImageNo[i] = Convert::DecodeDummySpriteImageNo(Extra) ? -1 : Convert::DecodeSpriteImageNo(Sprite);
+					Columns.Facing[i] = Convert::DecodeElemFacing(Extra) ? -1 : 1;
+					Columns.VFacing[i] = Convert::DecodeElemVFacing(Extra) ? -1 : 1;
+					Columns.AlphaA[i] = Convert::DecodeElemAlphaA(Extra);
+					Columns.AlphaS[i] = Convert::DecodeElemAlphaS(Extra);
+					Columns.AlphaD[i] = Convert::DecodeElemAlphaD(Extra);
+				}
+			}
+
+		public:
+			// GroupNoSpriteNumberAAlphaDExtraParami[ԂȀŊeڂɃfR[h
+			static void Decode(T_ElemColumns& Columns) noexcept {
+				const int32_t* const SpriteNumber = Columns.GroupNo.data();
+				const int32_t* const ExtraParam = Columns.AlphaD.data();
+				const size_t Size = Columns.size();
+				size_t Pos = 0;
+#if defined(__AVX2__)
+				const __m256i kMask16 = _mm256_set1_epi32(0xffff);
+				const __m256i kMask9 = _mm256_set1_epi32(511);
+				const __m256i kOne = _mm256_set1_epi32(1);
+				for (; Pos + 8 <= Size; Pos += 8) {
+					const __m256i Sprite = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(SpriteNumber + Pos));
+					const __m256i Extra = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ExtraParam + Pos));
+					// _~[w莞 -1 (0 - 1 Ƃ̘_a)
+					const __m256i DummyGroup = _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_and_si256(_mm256_srli_epi32(Extra, 29), kOne));
+					const __m256i DummyImage = _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_and_si256(_mm256_srli_epi32(Extra, 30), kOne));
+					const __m256i Facing = _mm256_and_si256(Extra, kOne);
+					const __m256i VFacing = _mm256_and_si256(_mm256_srli_epi32(Extra, 1), kOne);
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Columns.GroupNo.data() + Pos), _mm256_or_si256(_mm256_and_si256(Sprite, kMask16), DummyGroup));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Columns.ImageNo.data() + Pos), _mm256_or_si256(_mm256_srli_epi32(Sprite, 16), DummyImage));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Columns.Facing.data() + Pos), _mm256_sub_epi32(kOne, _mm256_add_epi32(Facing, Facing)));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Columns.VFacing.data() + Pos), _mm256_sub_epi32(kOne, _mm256_add_epi32(VFacing, VFacing)));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Columns.AlphaA.data() + Pos), _mm256_and_si256(_mm256_srli_epi32(Extra, 2), kMask9));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Columns.AlphaS.data() + Pos), _mm256_and_si256(_mm256_srli_epi32(Extra, 11), kMask9));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Columns.AlphaD.data() + Pos), _mm256_and_si256(_mm256_srli_epi32(Extra, 20), kMask9));
+				}
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				const __m128i kMask16 = _mm_set1_epi32(0xffff);
+				const __m128i kMask9 = _mm_set1_epi32(511);
+				const __m128i kOne = _mm_set1_epi32(1);
+				for (; Pos + 4 <= Size; Pos += 4) {
+					const __m128i Sprite = _mm_loadu_si128(reinterpret_cast<const __m128i*>(SpriteNumber + Pos));
+					const __m128i Extra = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ExtraParam + Pos));
+					// _~[w莞 -1 (0 - 1 Ƃ̘_a)
+					const __m128i DummyGroup = _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(_mm_srli_epi32(Extra, 29), kOne));
+					const __m128i DummyImage = _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(_mm_srli_epi32(Extra, 30), kOne));
+					const __m128i Facing = _mm_and_si128(Extra, kOne);
+					const __m128i VFacing = _mm_and_si128(_mm_srli_epi32(Extra, 1), kOne);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(Columns.GroupNo.data() + Pos), _mm_or_si128(_mm_and_si128(Sprite, kMask16), DummyGroup));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(Columns.ImageNo.data() + Pos), _mm_or_si128(_mm_srli_epi32(Sprite, 16), DummyImage));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(Columns.Facing.data() + Pos), _mm_sub_epi32(kOne, _mm_add_epi32(Facing, Facing)));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(Columns.VFacing.data() + Pos), _mm_sub_epi32(kOne, _mm_add_epi32(VFacing, VFacing)));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(Columns.AlphaA.data() + Pos), _mm_and_si128(_mm_srli_epi32(Extra, 2), kMask9));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(Columns.AlphaS.data() + Pos), _mm_and_si128(_mm_srli_epi32(Extra, 11), kMask9));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(Columns.AlphaD.data() + Pos), _mm_and_si128(_mm_srli_epi32(Extra, 20), kMask9));
+				}
+#endif
+				DecodeScalar(Columns, Pos, Size);
+			}
 		};
 
 		// Ajf[^Ǘ
 		struct T_AirAnimData {
-		private:
+		public:
 			struct T_AnimList {
 			private:
 				const int32_t kAnimNumber;		//
@@ -471,6 +1160,7 @@ namespace SAELib {
 				[[nodiscard]] int32_t ElemDataSize() const noexcept { return kElemDataSize; }
 				[[nodiscard]] int32_t ElemLoopstart() const noexcept { return Convert::DecodeElemLoopStart(kLoopstart); }
 				[[nodiscard]] bool ExistLoopstart() const noexcept { return Convert::DecodeExistLoopStart(kLoopstart); }
+				[[nodiscard]] int32_t Loopstart() const noexcept { return kLoopstart; }
 
 				T_AnimList(int32_t AnimNumber, int32_t Loopstart, ksize_t ElemDataStart, int32_t ElemDataSize)
 					: kAnimNumber(AnimNumber), kLoopstart(Loopstart), kElemDataStart(ElemDataStart), kElemDataSize(ElemDataSize) {
@@ -498,6 +1188,8 @@ namespace SAELib {
 				[[nodiscard]] int32_t AlphaD() const noexcept { return Convert::DecodeElemAlphaD(kExtraParam); }
 				[[nodiscard]] int32_t DummySpriteGroupNo() const noexcept { return Convert::DecodeDummySpriteGroupNo(kExtraParam); }
 				[[nodiscard]] int32_t DummySpriteImageNo() const noexcept { return Convert::DecodeDummySpriteImageNo(kExtraParam); }
+				[[nodiscard]] int32_t SpriteNumber() const noexcept { return kSpriteNumber; }
+				[[nodiscard]] int32_t ExtraParam() const noexcept { return kExtraParam; }
 
 				T_ElemData(int32_t SpriteNumber, int32_t PosX, int32_t PosY, int32_t ElemTime, int32_t ExtraParam)
 					: kSpriteNumber(SpriteNumber), kPosX(PosX), kPosY(PosY)
@@ -505,13 +1197,85 @@ namespace SAELib {
 				}
 			};
 
-			std::vector<T_AnimList> AnimList_ = {};
-			std::vector<T_ElemData> ElemData_ = {};
+			// 蔻̋`(X1 <= X2AY1 <= Y2 ɕבւĕێ)
+			struct T_ClsnBox {
+			private:
+				const int32_t kX1;	// [
+				const int32_t kY1;	// [
+				const int32_t kX2;	// E[
+				const int32_t kY2;	// [
+
+			public:
+				[[nodiscard]] int32_t X1() const noexcept { return kX1; }
+				[[nodiscard]] int32_t Y1() const noexcept { return kY1; }
+				[[nodiscard]] int32_t X2() const noexcept { return kX2; }
+				[[nodiscard]] int32_t Y2() const noexcept { return kY2; }
+
+				T_ClsnBox(int32_t X1, int32_t Y1, int32_t X2, int32_t Y2)
+					: kX1(std::min(X1, X2)), kY1(std::min(Y1, Y2)), kX2(std::max(X1, X2)), kY2(std::max(Y1, Y2)) {
+				}
+			};
+
+			// ElemQƂClsnBox_͈̔(Defaultw̋`͕Elemœ͈͂L)
+			struct T_ElemClsn {
+				ksize_t Clsn1Start = 0;
+				ksize_t Clsn2Start = 0;
+				int32_t Clsn1Size = 0;
+				int32_t Clsn2Size = 0;
+
+				// QƂ`̖
+				[[nodiscard]] ksize_t End() const noexcept { return std::max(Clsn1Start + Clsn1Size, Clsn2Start + Clsn2Size); }
+
+				[[nodiscard]] bool operator==(const T_ElemClsn& Other) const noexcept {
+					return Clsn1Start == Other.Clsn1Start && Clsn2Start == Other.Clsn2Start && Clsn1Size == Other.Clsn1Size && Clsn2Size == Other.Clsn2Size;
+				}
+			};
+
+		private:
+			// AjƂ̍Đԏ
+			struct T_AnimTime {
+				int64_t AnimTime;	// Ŝ̍Đ(-1 = \ԂElemŒ~)
+				int64_t LoopTime;	// [vJnElem̊Jn
+			};
+
+			// l͈̔͂t@CElem(12byteAExtraParam͎ނƂ̕\̓Yŕێ)
+			struct T_NarrowElemData {
+				int32_t SpriteNumber;
+				int16_t PosX;
+				int16_t PosY;
+				int16_t ElemTime;
+				uint16_t ExtraParamIndex;
+			};
+
+			std::pmr::vector<T_AnimList> AnimList_ = {};
+			std::pmr::vector<T_ElemData> ElemData_ = {};	// d͓eElem1̂݊i[(`ւ̕ϊ͋)
+			std::pmr::vector<T_NarrowElemData> NarrowElemData_ = {};	// `ւ̕ϊ̂݁AElemData_ƓY
+			std::pmr::vector<int32_t> ExtraParamTable_ = {};	// `ւ̕ϊ̂݁AExtraParam̎()
+			std::pmr::vector<ksize_t> ElemId_ = {};			// d̂݁AElem̓Y  ElemData_̓Y(̏ꍇ͓Y)
+			std::pmr::vector<T_AnimTime> AnimTime_ = {};
+			std::pmr::vector<int64_t> ElemStartTime_ = {};	// Aj擪ElemJnԂ̗ݐϘa(~Elemȍ~͍ől)
+			std::pmr::vector<T_ClsnBox> ClsnBox_ = {};		// SAj̋`(AjƂɘAĊi[)
+			std::pmr::vector<T_ElemClsn> ClsnSet_ = {};		// ElemQƂ͈͂̑g(擪͋`ȂAAElemœg͋L)
+			std::pmr::vector<ksize_t> ElemClsn_ = {};		// Elem̓YClsnSet_̓Y(Clsn1ꍇ͋)
 		public:
-			[[nodiscard]] const std::vector<T_AnimList>& AnimList() const noexcept { return AnimList_; }
-			[[nodiscard]] const std::vector<T_ElemData>& ElemData() const noexcept { return ElemData_; }
+			[[nodiscard]] const std::pmr::vector<T_AnimList>& AnimList() const noexcept { return AnimList_; }
+			[[nodiscard]] const std::pmr::vector<T_ElemData>& ElemData() const noexcept { return ElemData_; }
+			[[nodiscard]] const std::pmr::vector<ksize_t>& ElemId() const noexcept { return ElemId_; }
 			[[nodiscard]] const T_AnimList& AnimList(ksize_t index) const noexcept { return AnimList_[index]; }
-			[[nodiscard]] const T_ElemData& ElemData(ksize_t index) const noexcept { return ElemData_[index]; }
+			[[nodiscard]] T_ElemData ElemData(ksize_t index) const noexcept {
+				const ksize_t Slot = ElemId_.empty() ? index : ElemId_[index];
+				if (NarrowElemData_.empty()) { return ElemData_[Slot]; }
+				const T_NarrowElemData& Elem = NarrowElemData_[Slot];
+				return T_ElemData(Elem.SpriteNumber, Elem.PosX, Elem.PosY, Elem.ElemTime, ExtraParamTable_[Elem.ExtraParamIndex]);
+			}
+			[[nodiscard]] ksize_t NumElem() const noexcept { return static_cast<ksize_t>(!ElemId_.empty() ? ElemId_.size() : NumStoredElem()); }
+			[[nodiscard]] ksize_t NumStoredElem() const noexcept { return static_cast<ksize_t>(ElemData_.size() + NarrowElemData_.size()); }
+			[[nodiscard]] bool IsNarrowElem() const noexcept { return !NarrowElemData_.empty(); }
+			[[nodiscard]] size_t ElemRecordSize() const noexcept { return IsNarrowElem() ? sizeof(T_NarrowElemData) : sizeof(T_ElemData); }
+			[[nodiscard]] const std::pmr::vector<T_ClsnBox>& ClsnBox() const noexcept { return ClsnBox_; }
+			[[nodiscard]] const std::pmr::vector<T_ElemClsn>& ClsnSet() const noexcept { return ClsnSet_; }
+			[[nodiscard]] const std::pmr::vector<ksize_t>& ElemClsn() const noexcept { return ElemClsn_; }
+			[[nodiscard]] T_ElemClsn ElemClsn(ksize_t index) const noexcept { return index < ElemClsn_.size() ? ClsnSet_[ElemClsn_[index]] : T_ElemClsn{}; }
 
 			void AddAnimList(int32_t AnimNumber, int32_t Loopstart, ksize_t ElemDataStart, int32_t ElemDataSize) {
 				AnimList_.emplace_back(T_AnimList(AnimNumber, Loopstart, ElemDataStart, ElemDataSize));
@@ -521,66 +1285,872 @@ namespace SAELib {
 				ElemData_.emplace_back(T_ElemData(SpriteNumber, PosX, PosY, ElemTime, ExtraParam));
 			}
 
-		public:
-			T_AirAnimData() = default;
-
-			void reserve(ksize_t NumImage, ksize_t FileSize, ksize_t PaletteSize) {
-				AnimList_.reserve(NumImage);
-				ElemData_.reserve(NumImage);
+			void AddClsnBox(int32_t X1, int32_t Y1, int32_t X2, int32_t Y2) {
+				ClsnBox_.emplace_back(T_ClsnBox(X1, Y1, X2, Y2));
 			}
 
-			void clear() {
-				AnimList_.clear();
-				ElemData_.clear();
+			// ̋`j(ǂElemQƂȂ`̌n)
+			void TrimClsnBox(ksize_t Size) {
+				while (ClsnBox_.size() > Size) { ClsnBox_.pop_back(); }
 			}
 
-			void shrink_to_fit() {
-				AnimList_.shrink_to_fit();
-				ElemData_.shrink_to_fit();
+			// OɒǉElemClsn(ŏɋ`Elem܂ł͔zȂA` 0 ͈̔͂̊Jnʒu 0 ɑ)
+			void AddElemClsn(T_ElemClsn Clsn) {
+				if (!Clsn.Clsn1Size) { Clsn.Clsn1Start = 0; }
+				if (!Clsn.Clsn2Size) { Clsn.Clsn2Start = 0; }
+				const bool Empty = !Clsn.Clsn1Size && !Clsn.Clsn2Size;
+				if (Empty && ElemClsn_.empty()) { return; }
+				if (ClsnSet_.empty()) { ClsnSet_.push_back({}); }
+				if (!Empty && !(ClsnSet_.back() == Clsn)) { ClsnSet_.push_back(Clsn); }
+				if (ElemClsn_.size() + 1 < NumElem()) { ElemClsn_.resize(NumElem() - 1, 0); }
+				ElemClsn_.push_back(Empty ? 0 : static_cast<ksize_t>(ClsnSet_.size() - 1));
 			}
 
-			[[nodiscard]] bool empty() const noexcept { return AnimList_.empty() && ElemData_.empty(); }
-		};
+			// ʂ̃Ajf[^Aj1Elemƕ(zbg[hŖύXubN̍ėpɎgp)
+			void AppendAnim(const T_AirAnimData& Source, ksize_t AnimIndex) {
+				const T_AnimList& Anim = Source.AnimList(AnimIndex);
+				const ksize_t ElemDataStart = NumElem();
+
+				// AjQƂ`͈̔͂܂Ƃ߂ĕʂAeElem̎Qƈʒutւ
+				ksize_t BoxBegin = KSIZE_MAX;
+				ksize_t BoxEnd = 0;
+				for (int32_t i = 0; i < Anim.ElemDataSize() && !Source.ElemClsn_.empty(); ++i) {
+					const T_ElemClsn Clsn = Source.ElemClsn(Anim.ElemDataStart() + i);
+					if (Clsn.Clsn1Size) {
+						BoxBegin = std::min(BoxBegin, Clsn.Clsn1Start);
+						BoxEnd = std::max<ksize_t>(BoxEnd, Clsn.Clsn1Start + Clsn.Clsn1Size);
+					}
+					if (Clsn.Clsn2Size) {
+						BoxBegin = std::min(BoxBegin, Clsn.Clsn2Start);
+						BoxEnd = std::max<ksize_t>(BoxEnd, Clsn.Clsn2Start + Clsn.Clsn2Size);
+					}
+				}
+				const ksize_t BoxStart = static_cast<ksize_t>(ClsnBox_.size());
+				for (ksize_t i = BoxBegin; i < BoxEnd; ++i) {
+					ClsnBox_.push_back(Source.ClsnBox_[i]);
+				}
 
-		struct T_ActionBegin {
-		private:
-			inline static constexpr int32_t kAnimNumberIndex = 1;
+				for (int32_t i = 0; i < Anim.ElemDataSize(); ++i) {
+					ElemData_.push_back(Source.ElemData(Anim.ElemDataStart() + i));
+					T_ElemClsn Clsn = Source.ElemClsn(Anim.ElemDataStart() + i);
+					if (Clsn.Clsn1Size) { Clsn.Clsn1Start = Clsn.Clsn1Start - BoxBegin + BoxStart; }
+					if (Clsn.Clsn2Size) { Clsn.Clsn2Start = Clsn.Clsn2Start - BoxBegin + BoxStart; }
+					AddElemClsn(Clsn);
+				}
+				AddAnimList(Anim.AnimNumber(), Anim.Loopstart(), ElemDataStart, Anim.ElemDataSize());
+			}
 
-			const std::smatch& kRegexMatch;
-			const int32_t kTextLineCount;
-			const int32_t kAnimNumber;
+			// ǂݍ݊ElemJnԂ̗ݐϘa쐬
+			void BuildTimeline() {
+				AnimTime_.clear();
+				AnimTime_.reserve(AnimList_.size());
+				ElemStartTime_.assign(NumElem(), std::numeric_limits<int64_t>::max());
+
+				for (const auto& Anim : AnimList_) {
+					int64_t Time = 0;
+					for (int32_t i = 0; i < Anim.ElemDataSize(); ++i) {
+						const ksize_t Index = Anim.ElemDataStart() + i;
+						ElemStartTime_[Index] = Time;
+						if (ElemData(Index).ElemTime() < 0) {
+							Time = -1;
+							break;
+						}
+						Time += ElemData(Index).ElemTime();
+					}
+					const int32_t LoopElem = (Anim.ExistLoopstart() && Anim.ElemLoopstart() < Anim.ElemDataSize()) ? Anim.ElemLoopstart() : 0;
+					const int64_t LoopTime = Anim.ElemDataSize() ? ElemStartTime_[Anim.ElemDataStart() + LoopElem] : 0;
+					AnimTime_.push_back({ Time, (Time < 0 || LoopTime > Time) ? 0 : LoopTime });
+				}
+			}
 
-			[[nodiscard]] int32_t FromChars(int32_t index) const noexcept {
-				int32_t ChersValue;
-				std::from_chars_result Result = std::from_chars(&*kRegexMatch[index].first, (&*kRegexMatch[index].first) + kRegexMatch[index].length(), ChersValue);
+			/**
+			* @brief eElem܂Ƃ߂
+			*
+			* @SڂvElemElemData_1ɂ܂Ƃ߁AElem̓Y܂Ƃ߂ElemId_쐬܂
+			*
+			* @Elem̓Y(AnimList̊JnʒuEJnԁEClsn)͕ς܂A͊1̂݌Ăяo܂
+			*/
+			void PoolElemData() {
+				if (!ElemId_.empty() || ElemData_.empty()) { return; }
 
-				if (Result.ec != std::errc{}) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::FromCharsConvertFailed, ChersValue, kTextLineCount);
-					return -1;
+				const auto Hash = [](const T_ElemData& Elem) noexcept {
+					uint64_t Value = static_cast<uint32_t>(Elem.SpriteNumber());
+					for (const int32_t Param : { Elem.PosX(), Elem.PosY(), Elem.ElemTime(), Elem.ExtraParam() }) {
+						Value = (Value ^ static_cast<uint32_t>(Param)) * 0x9E3779B97F4A7C15ull;
+					}
+					return static_cast<size_t>(Value ^ (Value >> 32));
+				};
+				const auto Equal = [](const T_ElemData& a, const T_ElemData& b) noexcept {
+					return a.SpriteNumber() == b.SpriteNumber() && a.PosX() == b.PosX() && a.PosY() == b.PosY() && a.ElemTime() == b.ElemTime() && a.ExtraParam() == b.ExtraParam();
+				};
+
+				// I[vAhX@(`T)ōŏɌꂽElem̓Y
+				const size_t Size = ElemData_.size();
+				size_t Capacity = 16;
+				while (Capacity < Size * 2) { Capacity *= 2; }
+				std::vector<ksize_t> Table(Capacity, KSIZE_MAX);
+				std::vector<ksize_t> FirstIndex = {};
+				std::pmr::vector<ksize_t> PooledElemId(ElemId_.get_allocator());
+				PooledElemId.reserve(Size);
+				for (size_t i = 0; i < Size; ++i) {
+					size_t Slot = Hash(ElemData_[i]) & (Capacity - 1);
+					while (Table[Slot] != KSIZE_MAX && !Equal(ElemData_[FirstIndex[Table[Slot]]], ElemData_[i])) {
+						Slot = (Slot + 1) & (Capacity - 1);
+					}
+					if (Table[Slot] == KSIZE_MAX) {
+						Table[Slot] = static_cast<ksize_t>(FirstIndex.size());
+						FirstIndex.push_back(static_cast<ksize_t>(i));
+					}
+					PooledElemId.push_back(Table[Slot]);
 				}
 
-				// ɔ͈̓`FbN
-				if (!CheckRange::kAnimNumber.CheckRange(ChersValue)) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::AnimNumberOutOfRange, ChersValue, kTextLineCount);
-					return -1;
+				std::pmr::vector<T_ElemData> PooledElemData(ElemData_.get_allocator());
+				PooledElemData.reserve(FirstIndex.size());
+				for (const ksize_t Index : FirstIndex) {
+					PooledElemData.push_back(ElemData_[Index]);
 				}
-				return ChersValue;
+				ElemData_.swap(PooledElemData);
+				ElemId_.swap(PooledElemId);
 			}
 
-			[[nodiscard]] int32_t GetAnimNumber() const noexcept { return FromChars(kAnimNumberIndex); }
-
-		public:
-			int32_t AnimNumber() const noexcept { return kAnimNumber; }
-
-			T_ActionBegin(std::smatch& RegexMatch, int32_t TextLineCount)
-				: kRegexMatch(RegexMatch), kTextLineCount(TextLineCount)
-				, kAnimNumber(GetAnimNumber()) {
+			/**
+			* @brief Elem`ɕϊ
+			*
+			* @SElem̍WE\Ԃ int16_t Ɏ܂AExtraParam65536ވȉ̏ꍇ̂݁AElemData_12byteNarrowElemData_ɒu܂
+			*
+			* @܂Ȃꍇ͉܂A͊(d)1̂݌Ăяo܂
+			*/
+			void NarrowElemData() {
+				if (IsNarrowElem() || ElemData_.empty()) { return; }
+
+				const auto Fit = [](int32_t Value) noexcept { return Value >= std::numeric_limits<int16_t>::min() && Value <= std::numeric_limits<int16_t>::max(); };
+				std::vector<int32_t> ExtraParamList = {};
+				ExtraParamList.reserve(ElemData_.size());
+				for (const auto& Elem : ElemData_) {
+					if (!Fit(Elem.PosX()) || !Fit(Elem.PosY()) || !Fit(Elem.ElemTime())) { return; }
+					ExtraParamList.push_back(Elem.ExtraParam());
+				}
+				std::sort(ExtraParamList.begin(), ExtraParamList.end());
+				ExtraParamList.erase(std::unique(ExtraParamList.begin(), ExtraParamList.end()), ExtraParamList.end());
+				if (ExtraParamList.size() > size_t(1) << 16) { return; }
+
+				ExtraParamTable_.assign(ExtraParamList.begin(), ExtraParamList.end());
+				NarrowElemData_.reserve(ElemData_.size());
+				for (const auto& Elem : ElemData_) {
+					const auto ExtraParam = std::lower_bound(ExtraParamList.begin(), ExtraParamList.end(), Elem.ExtraParam());
+					NarrowElemData_.push_back({ Elem.SpriteNumber(), static_cast<int16_t>(Elem.PosX()), static_cast<int16_t>(Elem.PosY()), static_cast<int16_t>(Elem.ElemTime()),
+						static_cast<uint16_t>(ExtraParam - ExtraParamList.begin()) });
+				}
+				std::pmr::vector<T_ElemData>(ElemData_.get_allocator()).swap(ElemData_);
 			}
-		};
 
-		struct T_AnimParam {
-		private:
-			inline static constexpr int32_t kGroupNoIndex = 1;
+			[[nodiscard]] int64_t AnimTime(ksize_t AnimIndex) const noexcept { return AnimTime_[AnimIndex].AnimTime; }
+			[[nodiscard]] int64_t ElemStartTime(ksize_t ElemIndex) const noexcept { return ElemStartTime_[ElemIndex]; }
+
+			/**
+			* @brief w莞Ԃɕ\Elem̎擾
+			*
+			* @ݐϘa񕪒TAAj擪Tickoߎ_Elemԍ(Aj̔ԍ)Ԃ܂
+			*
+			* @Ŝ̍ĐԈȍ~̓[vJnElemJԂA\ԂElemɓBꍇ͂ElemŒ~܂
+			*
+			* @param ksize_t AnimIndex AnimList̓Y
+			* @param int64_t Tick Aj擪̌oߎ(0ƂĈ)
+			* @return int32_t Elemԍ
+			*/
+			[[nodiscard]] int32_t ElemIndexAtTime(ksize_t AnimIndex, int64_t Tick) const noexcept {
+				const T_AnimList& Anim = AnimList_[AnimIndex];
+				const T_AnimTime& Time = AnimTime_[AnimIndex];
+				const int64_t* const Start = ElemStartTime_.data() + Anim.ElemDataStart();
+
+				Tick = std::max<int64_t>(Tick, 0);
+				if (Time.AnimTime >= 0 && Tick >= Time.AnimTime) {
+					const int64_t LoopPeriod = Time.AnimTime - Time.LoopTime;
+					if (LoopPeriod > 0) { Tick = Time.LoopTime + (Tick - Time.LoopTime) % LoopPeriod; }
+				}
+				return static_cast<int32_t>(std::upper_bound(Start, Start + Anim.ElemDataSize(), Tick) - Start) - 1;
+			}
+
+		public:
+			T_AirAnimData() = default;
+			explicit T_AirAnimData(std::pmr::memory_resource* Resource)
+				: AnimList_(Resource), ElemData_(Resource), NarrowElemData_(Resource), ExtraParamTable_(Resource), ElemId_(Resource), AnimTime_(Resource), ElemStartTime_(Resource), ClsnBox_(Resource), ClsnSet_(Resource), ElemClsn_(Resource) {
+			}
+			T_AirAnimData(const T_AirAnimData& Source, std::pmr::memory_resource* Resource)
+				: AnimList_(Source.AnimList_, Resource), ElemData_(Source.ElemData_, Resource)
+				, NarrowElemData_(Source.NarrowElemData_, Resource), ExtraParamTable_(Source.ExtraParamTable_, Resource), ElemId_(Source.ElemId_, Resource)
+				, AnimTime_(Source.AnimTime_, Resource), ElemStartTime_(Source.ElemStartTime_, Resource)
+				, ClsnBox_(Source.ClsnBox_, Resource), ClsnSet_(Source.ClsnSet_, Resource), ElemClsn_(Source.ElemClsn_, Resource) {
+			}
+
+			void reserve(ksize_t NumAnim, ksize_t NumElem) {
+				AnimList_.reserve(NumAnim);
+				ElemData_.reserve(NumElem);
+			}
+
+			void clear() {
+				AnimList_.clear();
+				ElemData_.clear();
+				NarrowElemData_.clear();
+				ExtraParamTable_.clear();
+				ElemId_.clear();
+				AnimTime_.clear();
+				ElemStartTime_.clear();
+				ClsnBox_.clear();
+				ClsnSet_.clear();
+				ElemClsn_.clear();
+			}
+
+			void shrink_to_fit() {
+				AnimList_.shrink_to_fit();
+				ElemData_.shrink_to_fit();
+				NarrowElemData_.shrink_to_fit();
+				ExtraParamTable_.shrink_to_fit();
+				ElemId_.shrink_to_fit();
+				AnimTime_.shrink_to_fit();
+				ElemStartTime_.shrink_to_fit();
+				ClsnBox_.shrink_to_fit();
+				ClsnSet_.shrink_to_fit();
+				ElemClsn_.shrink_to_fit();
+			}
+
+			// Ǒς肪傫Oꂽẑݐ؂l(eʂ̗]肪vf̔𒴂ꍇ)
+			// ؂l߂͕ʂ𔺂ꎞIɎgpʂ邽߁A̗]͂̂܂܂ɂ
+			void ShrinkOverReserved() {
+				if (AnimList_.capacity() - AnimList_.size() > AnimList_.size() / 2) { AnimList_.shrink_to_fit(); }
+				if (ElemData_.capacity() - ElemData_.size() > ElemData_.size() / 2) { ElemData_.shrink_to_fit(); }
+			}
+
+			[[nodiscard]] bool empty() const noexcept { return AnimList_.empty() && NumStoredElem() == 0; }
+
+			// ElemŜڂƂ̔zɓWJ(ʒuEԂ͓]uASpriteNumber/ExtraParam͈ꊇfR[h)
+			void DecodeColumns(T_ElemColumns& Columns) const {
+				const size_t Size = NumElem();
+				Columns.resize(Size);
+				for (size_t i = 0; i < Size; ++i) {
+					const T_ElemData Elem = ElemData(static_cast<ksize_t>(i));
+					Columns.GroupNo[i] = Elem.SpriteNumber();
+					Columns.PosX[i] = Elem.PosX();
+					Columns.PosY[i] = Elem.PosY();
+					Columns.ElemTime[i] = Elem.ElemTime();
+					Columns.AlphaD[i] = Elem.ExtraParam();
+				}
+				T_ElemDecoder::Decode(Columns);
+			}
+
+			[[nodiscard]] size_t MemorySize() const noexcept {
+				return AnimList_.capacity() * sizeof(T_AnimList) + ElemData_.capacity() * sizeof(T_ElemData) + ElemId_.capacity() * sizeof(ksize_t) +
+					NarrowElemData_.capacity() * sizeof(T_NarrowElemData) + ExtraParamTable_.capacity() * sizeof(int32_t) +
+					AnimTime_.capacity() * sizeof(T_AnimTime) + ElemStartTime_.capacity() * sizeof(int64_t) +
+					ClsnBox_.capacity() * sizeof(T_ClsnBox) + ClsnSet_.capacity() * sizeof(T_ElemClsn) + ElemClsn_.capacity() * sizeof(ksize_t);
+			}
+			[[nodiscard]] size_t DataSize() const noexcept {
+				return AnimList_.size() * sizeof(T_AnimList) + ElemData_.size() * sizeof(T_ElemData) + ElemId_.size() * sizeof(ksize_t) +
+					NarrowElemData_.size() * sizeof(T_NarrowElemData) + ExtraParamTable_.size() * sizeof(int32_t) +
+					AnimTime_.size() * sizeof(T_AnimTime) + ElemStartTime_.size() * sizeof(int64_t) +
+					ClsnBox_.size() * sizeof(T_ClsnBox) + ClsnSet_.size() * sizeof(T_ElemClsn) + ElemClsn_.size() * sizeof(ksize_t);
+			}
+
+		private:
+			// LbVt@C̃R[h`
+			struct T_AnimListRecord {
+				int32_t AnimNumber;
+				ksize_t ElemDataStart;
+				int32_t ElemDataSize;
+				int32_t Loopstart;
+			};
+			struct T_ElemDataRecord {
+				int32_t SpriteNumber;
+				int32_t PosX;
+				int32_t PosY;
+				int32_t ElemTime;
+				int32_t ExtraParam;
+			};
+			struct T_ClsnBoxRecord {
+				int32_t X1;
+				int32_t Y1;
+				int32_t X2;
+				int32_t Y2;
+			};
+
+		public:
+			void WriteBinary(std::ostream& File) const {
+				std::vector<T_AnimListRecord> AnimListRecord = {};
+				AnimListRecord.reserve(AnimList_.size());
+				for (const auto& Anim : AnimList_) {
+					AnimListRecord.push_back({ Anim.AnimNumber(), Anim.ElemDataStart(), Anim.ElemDataSize(), Anim.Loopstart() });
+				}
+				std::vector<T_ElemDataRecord> ElemDataRecord = {};
+				ElemDataRecord.reserve(NumElem());
+				for (ksize_t i = 0; i < NumElem(); ++i) {
+					const T_ElemData Elem = ElemData(i);
+					ElemDataRecord.push_back({ Elem.SpriteNumber(), Elem.PosX(), Elem.PosY(), Elem.ElemTime(), Elem.ExtraParam() });
+				}
+				File.write(reinterpret_cast<const char*>(AnimListRecord.data()), AnimListRecord.size() * sizeof(T_AnimListRecord));
+				File.write(reinterpret_cast<const char*>(ElemDataRecord.data()), ElemDataRecord.size() * sizeof(T_ElemDataRecord));
+
+				std::vector<T_ClsnBoxRecord> ClsnBoxRecord = {};
+				ClsnBoxRecord.reserve(ClsnBox_.size());
+				for (const auto& Box : ClsnBox_) {
+					ClsnBoxRecord.push_back({ Box.X1(), Box.Y1(), Box.X2(), Box.Y2() });
+				}
+				File.write(reinterpret_cast<const char*>(ClsnSet_.data()), ClsnSet_.size() * sizeof(T_ElemClsn));
+				File.write(reinterpret_cast<const char*>(ElemClsn_.data()), ElemClsn_.size() * sizeof(ksize_t));
+				File.write(reinterpret_cast<const char*>(ClsnBoxRecord.data()), ClsnBoxRecord.size() * sizeof(T_ClsnBoxRecord));
+			}
+
+			[[nodiscard]] bool ReadBinary(std::istream& File, ksize_t NumAnim, ksize_t NumElem, ksize_t NumClsnSet, ksize_t NumElemClsn, ksize_t NumClsnBox) {
+				if (NumElemClsn != 0 && (NumElemClsn != NumElem || NumClsnSet == 0)) { return false; }
+
+				std::vector<T_AnimListRecord> AnimListRecord(NumAnim);
+				std::vector<T_ElemDataRecord> ElemDataRecord(NumElem);
+				std::vector<T_ElemClsn> ClsnSetRecord(NumClsnSet);
+				std::vector<ksize_t> ElemClsnRecord(NumElemClsn);
+				std::vector<T_ClsnBoxRecord> ClsnBoxRecord(NumClsnBox);
+				if (!File.read(reinterpret_cast<char*>(AnimListRecord.data()), AnimListRecord.size() * sizeof(T_AnimListRecord)) ||
+					!File.read(reinterpret_cast<char*>(ElemDataRecord.data()), ElemDataRecord.size() * sizeof(T_ElemDataRecord)) ||
+					!File.read(reinterpret_cast<char*>(ClsnSetRecord.data()), ClsnSetRecord.size() * sizeof(T_ElemClsn)) ||
+					!File.read(reinterpret_cast<char*>(ElemClsnRecord.data()), ElemClsnRecord.size() * sizeof(ksize_t)) ||
+					!File.read(reinterpret_cast<char*>(ClsnBoxRecord.data()), ClsnBoxRecord.size() * sizeof(T_ClsnBoxRecord))) {
+					return false;
+				}
+				for (const auto& Clsn : ClsnSetRecord) {
+					if (Clsn.Clsn1Size < 0 || Clsn.Clsn2Size < 0 ||
+						static_cast<uint64_t>(Clsn.Clsn1Start) + static_cast<uint32_t>(Clsn.Clsn1Size) > NumClsnBox ||
+						static_cast<uint64_t>(Clsn.Clsn2Start) + static_cast<uint32_t>(Clsn.Clsn2Size) > NumClsnBox) {
+						return false;
+					}
+				}
+				if (std::any_of(ElemClsnRecord.begin(), ElemClsnRecord.end(), [NumClsnSet](ksize_t index) { return index >= NumClsnSet; })) { return false; }
+
+				clear();
+				AnimList_.reserve(NumAnim);
+				ElemData_.reserve(NumElem);
+				for (const auto& Anim : AnimListRecord) {
+					if (static_cast<uint64_t>(Anim.ElemDataStart) + static_cast<uint32_t>(Anim.ElemDataSize) > NumElem) {
+						clear();
+						return false;
+					}
+					AddAnimList(Anim.AnimNumber, Anim.Loopstart, Anim.ElemDataStart, Anim.ElemDataSize);
+				}
+				for (const auto& Elem : ElemDataRecord) {
+					AddElemData(Elem.SpriteNumber, Elem.PosX, Elem.PosY, Elem.ElemTime, Elem.ExtraParam);
+				}
+				ClsnSet_.assign(ClsnSetRecord.begin(), ClsnSetRecord.end());
+				ElemClsn_.assign(ElemClsnRecord.begin(), ElemClsnRecord.end());
+				ClsnBox_.reserve(NumClsnBox);
+				for (const auto& Box : ClsnBoxRecord) {
+					AddClsnBox(Box.X1, Box.Y1, Box.X2, Box.Y2);
+				}
+				return true;
+			}
+		};
+
+		// Clsn`̏dȂ蔻(AVX2 > SSE2 > XJ[̏ɃRpCɑI)
+		// Hurt̋`ڂƂ̔zɕבւAAttack̋`1ƕ̋`܂Ƃ߂Ĕr
+		struct T_ClsnTest {
+		private:
+			using T_ClsnBox = T_AirAnimData::T_ClsnBox;
+			static_assert(sizeof(T_ClsnBox) == sizeof(int32_t) * 4, "T_ClsnBox is loaded as 4 x int32_t");
+
+#if defined(__AVX2__)
+			inline static constexpr size_t kLaneSize = 8;
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+			inline static constexpr size_t kLaneSize = 4;
+#else
+			inline static constexpr size_t kLaneSize = 1;
+#endif
+			inline static constexpr size_t kBlockSize = 32;	// 1xɕבւHurt̋`(kLaneSize̔{)
+			inline static constexpr size_t kMinBlockSize = 4;	// 菭Ȃꍇ͕בւ1gr
+
+			// zuHurt̋`
+			struct T_Block {
+				alignas(32) int32_t X1[kBlockSize];
+				alignas(32) int32_t Y1[kBlockSize];
+				alignas(32) int32_t X2[kBlockSize];
+				alignas(32) int32_t Y2[kBlockSize];
+			};
+
+			// `zuʒuֈړ(Facing = -1 ̏ꍇX𔽓]A32bitŐ܂Ԃ)
+			static void Place(const T_ClsnBox& Box, int32_t PosX, int32_t PosY, int32_t Facing, int32_t& X1, int32_t& Y1, int32_t& X2, int32_t& Y2) noexcept {
+				const uint32_t BaseX = static_cast<uint32_t>(PosX);
+				const uint32_t BaseY = static_cast<uint32_t>(PosY);
+				X1 = static_cast<int32_t>(Facing < 0 ? BaseX - static_cast<uint32_t>(Box.X2()) : BaseX + static_cast<uint32_t>(Box.X1()));
+				X2 = static_cast<int32_t>(Facing < 0 ? BaseX - static_cast<uint32_t>(Box.X1()) : BaseX + static_cast<uint32_t>(Box.X2()));
+				Y1 = static_cast<int32_t>(BaseY + static_cast<uint32_t>(Box.Y1()));
+				Y2 = static_cast<int32_t>(BaseY + static_cast<uint32_t>(Box.Y2()));
+			}
+
+			// Hurt̋`Block̐擪zu
+			static void PlaceBlock(const T_ClsnBox* Box, size_t Size, int32_t PosX, int32_t PosY, int32_t Facing, T_Block& Block) noexcept {
+				size_t Pos = 0;
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				// 4`]učڂƂɕבւ
+				const __m128i BaseX = _mm_set1_epi32(PosX);
+				const __m128i BaseY = _mm_set1_epi32(PosY);
+				for (; Pos + 4 <= Size; Pos += 4) {
+					const __m128i Box0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Box + Pos));
+					const __m128i Box1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Box + Pos + 1));
+					const __m128i Box2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Box + Pos + 2));
+					const __m128i Box3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Box + Pos + 3));
+					const __m128i Low01 = _mm_unpacklo_epi32(Box0, Box1);
+					const __m128i Low23 = _mm_unpacklo_epi32(Box2, Box3);
+					const __m128i High01 = _mm_unpackhi_epi32(Box0, Box1);
+					const __m128i High23 = _mm_unpackhi_epi32(Box2, Box3);
+					const __m128i X1 = _mm_unpacklo_epi64(Low01, Low23);
+					const __m128i Y1 = _mm_unpackhi_epi64(Low01, Low23);
+					const __m128i X2 = _mm_unpacklo_epi64(High01, High23);
+					const __m128i Y2 = _mm_unpackhi_epi64(High01, High23);
+					_mm_store_si128(reinterpret_cast<__m128i*>(Block.X1 + Pos), Facing < 0 ? _mm_sub_epi32(BaseX, X2) : _mm_add_epi32(BaseX, X1));
+					_mm_store_si128(reinterpret_cast<__m128i*>(Block.X2 + Pos), Facing < 0 ? _mm_sub_epi32(BaseX, X1) : _mm_add_epi32(BaseX, X2));
+					_mm_store_si128(reinterpret_cast<__m128i*>(Block.Y1 + Pos), _mm_add_epi32(BaseY, Y1));
+					_mm_store_si128(reinterpret_cast<__m128i*>(Block.Y2 + Pos), _mm_add_epi32(BaseY, Y2));
+				}
+#endif
+				for (; Pos < Size; ++Pos) {
+					Place(Box[Pos], PosX, PosY, Facing, Block.X1[Pos], Block.Y1[Pos], Block.X2[Pos], Block.Y2[Pos]);
+				}
+			}
+
+			// Block̐擪Size([̔{)̋`̂ꂩ`(X1, Y1, X2, Y2)ƏdȂ邩
+			[[nodiscard]] static bool OverlapBlock(const T_Block& Block, size_t Size, int32_t X1, int32_t Y1, int32_t X2, int32_t Y2) noexcept {
+#if defined(__AVX2__)
+				const __m256i AttackX1 = _mm256_set1_epi32(X1);
+				const __m256i AttackY1 = _mm256_set1_epi32(Y1);
+				const __m256i AttackX2 = _mm256_set1_epi32(X2);
+				const __m256i AttackY2 = _mm256_set1_epi32(Y2);
+				for (size_t Pos = 0; Pos < Size; Pos += kLaneSize) {
+					// ĂǂȂ[ΏdȂ
+					const __m256i Apart = _mm256_or_si256(
+						_mm256_or_si256(_mm256_cmpgt_epi32(_mm256_load_si256(reinterpret_cast<const __m256i*>(Block.X1 + Pos)), AttackX2),
+							_mm256_cmpgt_epi32(AttackX1, _mm256_load_si256(reinterpret_cast<const __m256i*>(Block.X2 + Pos)))),
+						_mm256_or_si256(_mm256_cmpgt_epi32(_mm256_load_si256(reinterpret_cast<const __m256i*>(Block.Y1 + Pos)), AttackY2),
+							_mm256_cmpgt_epi32(AttackY1, _mm256_load_si256(reinterpret_cast<const __m256i*>(Block.Y2 + Pos)))));
+					if (_mm256_movemask_epi8(Apart) != -1) { return true; }
+				}
+				return false;
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				const __m128i AttackX1 = _mm_set1_epi32(X1);
+				const __m128i AttackY1 = _mm_set1_epi32(Y1);
+				const __m128i AttackX2 = _mm_set1_epi32(X2);
+				const __m128i AttackY2 = _mm_set1_epi32(Y2);
+				for (size_t Pos = 0; Pos < Size; Pos += kLaneSize) {
+					// ĂǂȂ[ΏdȂ
+					const __m128i Apart = _mm_or_si128(
+						_mm_or_si128(_mm_cmpgt_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(Block.X1 + Pos)), AttackX2),
+							_mm_cmpgt_epi32(AttackX1, _mm_load_si128(reinterpret_cast<const __m128i*>(Block.X2 + Pos)))),
+						_mm_or_si128(_mm_cmpgt_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(Block.Y1 + Pos)), AttackY2),
+							_mm_cmpgt_epi32(AttackY1, _mm_load_si128(reinterpret_cast<const __m128i*>(Block.Y2 + Pos)))));
+					if (_mm_movemask_epi8(Apart) != 0xffff) { return true; }
+				}
+				return false;
+#else
+				for (size_t Pos = 0; Pos < Size; ++Pos) {
+					if (Block.X1[Pos] <= X2 && X1 <= Block.X2[Pos] && Block.Y1[Pos] <= Y2 && Y1 <= Block.Y2[Pos]) { return true; }
+				}
+				return false;
+#endif
+			}
+
+		public:
+			/**
+			* @brief `̏dȂ蔻
+			*
+			* @Attack̋`̂ꂩHurt̋`̂ꂩƏdȂ邩Ԃ܂(ӂڂꍇdȂƂĈ܂)
+			*
+			* @e`͔zuʒu_ƂAFacing = -1 ̏ꍇX𔽓]Ĕ肵܂
+			*
+			* @zu̍W int32_t ͈̔͂𒴂ꍇ̌ʂ͕sł
+			*
+			* @return bool 茋 (false = dȂȂFtrue = dȂ)
+			*/
+			[[nodiscard]] static bool Overlap(const T_ClsnBox* Attack, size_t NumAttack, int32_t AttackPosX, int32_t AttackPosY, int32_t AttackFacing,
+				const T_ClsnBox* Hurt, size_t NumHurt, int32_t HurtPosX, int32_t HurtPosY, int32_t HurtFacing) noexcept {
+				if (NumAttack == 0) { return false; }
+
+				if (NumHurt < kMinBlockSize) {
+					for (size_t i = 0; i < NumHurt; ++i) {
+						int32_t HurtX1 = 0, HurtY1 = 0, HurtX2 = 0, HurtY2 = 0;
+						Place(Hurt[i], HurtPosX, HurtPosY, HurtFacing, HurtX1, HurtY1, HurtX2, HurtY2);
+						for (size_t j = 0; j < NumAttack; ++j) {
+							int32_t X1 = 0, Y1 = 0, X2 = 0, Y2 = 0;
+							Place(Attack[j], AttackPosX, AttackPosY, AttackFacing, X1, Y1, X2, Y2);
+							if (HurtX1 <= X2 && X1 <= HurtX2 && HurtY1 <= Y2 && Y1 <= HurtY2) { return true; }
+						}
+					}
+					return false;
+				}
+
+				T_Block Block;
+				for (size_t HurtStart = 0; HurtStart < NumHurt; HurtStart += kBlockSize) {
+					const size_t HurtSize = std::min(kBlockSize, NumHurt - HurtStart);
+					PlaceBlock(Hurt + HurtStart, HurtSize, HurtPosX, HurtPosY, HurtFacing, Block);
+					// [̔{܂Ŗ̋`𕡐(`d˂ĔrĂʂ͕ςȂ)
+					const size_t BlockSize = (HurtSize + kLaneSize - 1) / kLaneSize * kLaneSize;
+					for (size_t i = HurtSize; i < BlockSize; ++i) {
+						Block.X1[i] = Block.X1[HurtSize - 1];
+						Block.Y1[i] = Block.Y1[HurtSize - 1];
+						Block.X2[i] = Block.X2[HurtSize - 1];
+						Block.Y2[i] = Block.Y2[HurtSize - 1];
+					}
+
+					for (size_t i = 0; i < NumAttack; ++i) {
+						int32_t X1 = 0, Y1 = 0, X2 = 0, Y2 = 0;
+						Place(Attack[i], AttackPosX, AttackPosY, AttackFacing, X1, Y1, X2, Y2);
+						if (OverlapBlock(Block, BlockSize, X1, Y1, X2, Y2)) { return true; }
+					}
+				}
+				return false;
+			}
+		};
+
+		// XvCgԍ(GroupNo, ImageNo)  gpĂAjEElem̋t
+		// ԍ̏ɕׂԍꗗƁAԍƂ̎QƐAz(RefStart_[i]`RefStart_[i + 1])ŕێ
+		struct T_SpriteIndex {
+		public:
+			// QƐ(Aj̓YƁAAjElem̓Y)
+			struct T_SpriteRef {
+			private:
+				const ksize_t kAnimIndex;
+				const int32_t kElemIndex;
+
+			public:
+				[[nodiscard]] int32_t AnimIndex() const noexcept { return static_cast<int32_t>(kAnimIndex); }
+				[[nodiscard]] int32_t ElemIndex() const noexcept { return kElemIndex; }
+
+				T_SpriteRef(ksize_t AnimIndex, int32_t ElemIndex) noexcept : kAnimIndex(AnimIndex), kElemIndex(ElemIndex) {}
+			};
+
+		private:
+			std::pmr::vector<uint32_t> SpriteKey_ = {};	// GroupNo << 16 | ImageNo ()
+			std::pmr::vector<ksize_t> RefStart_ = {};	// SpriteKey_.size() + 1 (쐬ς݂ȂłȂ)
+			std::pmr::vector<T_SpriteRef> Ref_ = {};
+
+		public:
+			// GroupNoEImageNôǂ炩ȗꂽElem͓o^Ȃ
+			[[nodiscard]] static bool ExistSprite(const T_AirAnimData::T_ElemData& Elem) noexcept { return !Elem.DummySpriteGroupNo() && !Elem.DummySpriteImageNo(); }
+			[[nodiscard]] static constexpr uint32_t SpriteKey(int32_t GroupNo, int32_t ImageNo) noexcept { return static_cast<uint32_t>(GroupNo) << 16 | static_cast<uint32_t>(ImageNo); }
+
+			void Build(const T_AirAnimData& AirAnimData) {
+				struct T_Entry {
+					uint32_t Key;
+					ksize_t AnimIndex;
+					int32_t ElemIndex;
+				};
+				std::vector<T_Entry> EntryList = {};
+				EntryList.reserve(AirAnimData.NumElem());
+				for (size_t AnimIndex = 0; AnimIndex < AirAnimData.AnimList().size(); ++AnimIndex) {
+					const T_AirAnimData::T_AnimList& Anim = AirAnimData.AnimList(static_cast<ksize_t>(AnimIndex));
+					for (int32_t ElemIndex = 0; ElemIndex < Anim.ElemDataSize(); ++ElemIndex) {
+						const T_AirAnimData::T_ElemData Elem = AirAnimData.ElemData(Anim.ElemDataStart() + ElemIndex);
+						if (!ExistSprite(Elem)) { continue; }
+						EntryList.push_back({ SpriteKey(Elem.GroupNo(), Elem.ImageNo()), static_cast<ksize_t>(AnimIndex), ElemIndex });
+					}
+				}
+				// ԍ̎QƐ̓AjEElem̓Ŷ܂ܕׂ
+				std::stable_sort(EntryList.begin(), EntryList.end(), [](const T_Entry& a, const T_Entry& b) { return a.Key < b.Key; });
+
+				clear();
+				Ref_.reserve(EntryList.size());
+				for (size_t i = 0; i < EntryList.size(); ++i) {
+					if (i == 0 || EntryList[i].Key != EntryList[i - 1].Key) {
+						SpriteKey_.push_back(EntryList[i].Key);
+						RefStart_.push_back(static_cast<ksize_t>(i));
+					}
+					Ref_.emplace_back(EntryList[i].AnimIndex, EntryList[i].ElemIndex);
+				}
+				RefStart_.push_back(static_cast<ksize_t>(Ref_.size()));
+				SpriteKey_.shrink_to_fit();
+				RefStart_.shrink_to_fit();
+			}
+
+			// ԍ̎QƐ͈̔(o^̏ꍇ͋)
+			[[nodiscard]] std::pair<const T_SpriteRef*, const T_SpriteRef*> find(int32_t GroupNo, int32_t ImageNo) const noexcept {
+				const uint32_t Key = SpriteKey(GroupNo, ImageNo);
+				const auto it = std::lower_bound(SpriteKey_.begin(), SpriteKey_.end(), Key);
+				if (it == SpriteKey_.end() || *it != Key) { return { nullptr, nullptr }; }
+				const size_t Index = static_cast<size_t>(it - SpriteKey_.begin());
+				return { Ref_.data() + RefStart_[Index], Ref_.data() + RefStart_[Index + 1] };
+			}
+
+			[[nodiscard]] bool IsBuilt() const noexcept { return !RefStart_.empty(); }
+			[[nodiscard]] size_t MemorySize() const noexcept { return SpriteKey_.capacity() * sizeof(uint32_t) + RefStart_.capacity() * sizeof(ksize_t) + Ref_.capacity() * sizeof(T_SpriteRef); }
+			[[nodiscard]] size_t DataSize() const noexcept { return SpriteKey_.size() * sizeof(uint32_t) + RefStart_.size() * sizeof(ksize_t) + Ref_.size() * sizeof(T_SpriteRef); }
+
+			void clear() {
+				SpriteKey_.clear();
+				RefStart_.clear();
+				Ref_.clear();
+			}
+
+			T_SpriteIndex() = default;
+			explicit T_SpriteIndex(std::pmr::memory_resource* Resource) : SpriteKey_(Resource), RefStart_(Resource), Ref_(Resource) {}
+			T_SpriteIndex(const T_SpriteIndex& Source, std::pmr::memory_resource* Resource)
+				: SpriteKey_(Source.SpriteKey_, Resource), RefStart_(Source.RefStart_, Resource), Ref_(Source.Ref_, Resource) {
+			}
+		};
+
+		// s͂̕⏕(K\Ɠ󗝏1pXő)
+		struct T_LineScanner {
+		private:
+			const char* Current_ = nullptr;
+			const char* const kEnd = nullptr;
+
+		public:
+			[[nodiscard]] static constexpr bool IsSpace(char c) noexcept { return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r'; }
+			[[nodiscard]] static constexpr bool IsDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+			[[nodiscard]] bool End() const noexcept { return Current_ == kEnd; }
+			[[nodiscard]] char Peek() const noexcept { return *Current_; }
+
+			void SkipSpace() noexcept {
+				while (!End() && IsSpace(*Current_)) { ++Current_; }
+			}
+
+			[[nodiscard]] bool Consume(char c) noexcept {
+				if (End() || *Current_ != c) { return false; }
+				++Current_;
+				return true;
+			}
+
+			[[nodiscard]] bool Consume(std::string_view Text) noexcept {
+				if (static_cast<size_t>(kEnd - Current_) < Text.size() || std::string_view(Current_, Text.size()) != Text) { return false; }
+				Current_ += Text.size();
+				return true;
+			}
+
+			// -?\d+ ɑ
+			[[nodiscard]] bool ConsumeInteger(std::string_view& Value) noexcept {
+				const char* Pos = Current_;
+				if (Pos != kEnd && *Pos == '-') { ++Pos; }
+				const char* const DigitBegin = Pos;
+				while (Pos != kEnd && IsDigit(*Pos)) { ++Pos; }
+				if (Pos == DigitBegin) { return false; }
+				Value = std::string_view(Current_, static_cast<size_t>(Pos - Current_));
+				Current_ = Pos;
+				return true;
+			}
+
+			// 1̂܂܎擾
+			[[nodiscard]] bool ConsumeChar(std::string_view& Value) noexcept {
+				if (End()) { return false; }
+				Value = std::string_view(Current_++, 1);
+				return true;
+			}
+
+			// . ɑ(sȊO)
+			[[nodiscard]] bool ConsumeComment() noexcept {
+				for (; !End(); ++Current_) {
+					if (*Current_ == '\n' || *Current_ == '\r') { return false; }
+				}
+				return true;
+			}
+
+			T_LineScanner(std::string_view TextLine) : Current_(TextLine.data()), kEnd(TextLine.data() + TextLine.size()) {}
+		};
+
+		// s͌(K\̃Lv`O[vA}b`͋)
+		using T_LineMatch = std::array<std::string_view, 14>;
+
+		struct T_ActionBegin {
+		private:
+			inline static constexpr int32_t kAnimNumberIndex = 1;
+			inline static constexpr std::string_view kActionBegin = "[Begin Action ";
+
+			T_ErrorHandle& kErrorHandle;
+			const T_LineMatch& kLineMatch;
+			const int32_t kTextLineCount;
+			const int32_t kAnimNumber;
+
+			[[nodiscard]] int32_t FromChars(int32_t index) const {
+				int32_t ChersValue = 0;
+				std::from_chars_result Result = std::from_chars(kLineMatch[index].data(), kLineMatch[index].data() + kLineMatch[index].size(), ChersValue);
+
+				if (Result.ec != std::errc{}) {
+					kErrorHandle.SetError(ErrorMessage::FromCharsConvertFailed, ChersValue, kTextLineCount);
+					return -1;
+				}
+
+				// łɔ͈̓`FbN
+				if (!CheckRange::kAnimNumber.CheckRange(ChersValue)) {
+					kErrorHandle.SetError(ErrorMessage::AnimNumberOutOfRange, ChersValue, kTextLineCount);
+					return -1;
+				}
+				return ChersValue;
+			}
+
+			[[nodiscard]] int32_t GetAnimNumber() const { return FromChars(kAnimNumberIndex); }
+
+		public:
+			// \s*\[Begin Action (-?\d+)\]\s*(?:;(.*))? ɑ
+			[[nodiscard]] static bool Scan(std::string_view TextLine, T_LineMatch& LineMatch) noexcept {
+				T_LineScanner Scanner(TextLine);
+				LineMatch = {};
+				Scanner.SkipSpace();
+				if (!Scanner.Consume(kActionBegin) || !Scanner.ConsumeInteger(LineMatch[kAnimNumberIndex]) || !Scanner.Consume(']')) { return false; }
+				Scanner.SkipSpace();
+				return Scanner.End() || (Scanner.Consume(';') && Scanner.ConsumeComment());
+			}
+
+			int32_t AnimNumber() const noexcept { return kAnimNumber; }
+
+			T_ActionBegin(T_ErrorHandle& ErrorHandle, const T_LineMatch& LineMatch, int32_t TextLineCount)
+				: kErrorHandle(ErrorHandle), kLineMatch(LineMatch), kTextLineCount(TextLineCount)
+				, kAnimNumber(GetAnimNumber()) {
+			}
+		};
+
+		struct T_Loopstart {
+		private:
+			inline static constexpr std::string_view kLoopstart = "Loopstart";
+
+		public:
+			// \s*Loopstart ɑ
+			[[nodiscard]] static bool Scan(std::string_view TextLine) noexcept {
+				T_LineScanner Scanner(TextLine);
+				Scanner.SkipSpace();
+				return Scanner.Consume(kLoopstart) && Scanner.End();
+			}
+		};
+
+		struct T_ClsnParam {
+		private:
+			inline static constexpr int32_t kTypeIndex = 1;
+			inline static constexpr int32_t kDefaultIndex = 2;
+			inline static constexpr int32_t kCountIndex = 3;
+			inline static constexpr int32_t kX1Index = 4;
+			inline static constexpr int32_t kY1Index = 5;
+			inline static constexpr int32_t kX2Index = 6;
+			inline static constexpr int32_t kY2Index = 7;
+			inline static constexpr std::string_view kClsn = "Clsn";
+			inline static constexpr std::string_view kDefault = "Default";
+
+			T_ErrorHandle& kErrorHandle;
+			const T_LineMatch& kLineMatch;
+			const int32_t kTextLineCount;
+			const int32_t kX1;
+			const int32_t kY1;
+			const int32_t kX2;
+			const int32_t kY2;
+
+			[[nodiscard]] int32_t FromChars(int32_t index) const {
+				if (kLineMatch[index].empty()) { return 0; }
+
+				int32_t ChersValue = 0;
+				std::from_chars_result Result = std::from_chars(kLineMatch[index].data(), kLineMatch[index].data() + kLineMatch[index].size(), ChersValue);
+
+				if (Result.ec != std::errc{}) {
+					kErrorHandle.SetError(ErrorMessage::FromCharsConvertFailed, ChersValue, kTextLineCount);
+					return 0;
+				}
+				return ChersValue;
+			}
+
+		public:
+			// \s*Clsn([12])(Default)?\s*:\s*(-?\d+)\s*(?:;(.*))? 
+			// \s*Clsn([12])\[\s*(-?\d+)\s*\]\s*=\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*(?:;(.*))? ɑ
+			[[nodiscard]] static bool Scan(std::string_view TextLine, T_LineMatch& LineMatch) noexcept {
+				T_LineScanner Scanner(TextLine);
+				LineMatch = {};
+				Scanner.SkipSpace();
+				if (!Scanner.Consume(kClsn) || !Scanner.ConsumeChar(LineMatch[kTypeIndex]) ||
+					(LineMatch[kTypeIndex] != "1" && LineMatch[kTypeIndex] != "2")) {
+					return false;
+				}
+
+				if (Scanner.Consume('[')) {
+					Scanner.SkipSpace();
+					if (!Scanner.ConsumeInteger(LineMatch[kCountIndex])) { return false; }
+					Scanner.SkipSpace();
+					if (!Scanner.Consume(']')) { return false; }
+					Scanner.SkipSpace();
+					if (!Scanner.Consume('=')) { return false; }
+					for (int32_t index = kX1Index; index <= kY2Index; ++index) {
+						Scanner.SkipSpace();
+						if (index != kX1Index) {
+							if (!Scanner.Consume(',')) { return false; }
+							Scanner.SkipSpace();
+						}
+						if (!Scanner.ConsumeInteger(LineMatch[index])) { return false; }
+					}
+				}
+				else {
+					if (Scanner.Consume(kDefault)) { LineMatch[kDefaultIndex] = kDefault; }
+					Scanner.SkipSpace();
+					if (!Scanner.Consume(':')) { return false; }
+					Scanner.SkipSpace();
+					if (!Scanner.ConsumeInteger(LineMatch[kCountIndex])) { return false; }
+				}
+				Scanner.SkipSpace();
+				return Scanner.End() || (Scanner.Consume(';') && Scanner.ConsumeComment());
+			}
+
+			// 1 = Clsn1(U) 2 = Clsn2(炢)
+			int32_t Type() const noexcept { return kLineMatch[kTypeIndex] == "1" ? 1 : 2; }
+			// ClsnNDefault: s
+			bool Default() const noexcept { return !kLineMatch[kDefaultIndex].empty(); }
+			// ClsnN[Y] = s
+			bool IsBox() const noexcept { return !kLineMatch[kX1Index].empty(); }
+			int32_t X1() const noexcept { return kX1; }
+			int32_t Y1() const noexcept { return kY1; }
+			int32_t X2() const noexcept { return kX2; }
+			int32_t Y2() const noexcept { return kY2; }
+
+			T_ClsnParam(T_ErrorHandle& ErrorHandle, const T_LineMatch& LineMatch, int32_t TextLineCount)
+				: kErrorHandle(ErrorHandle), kLineMatch(LineMatch), kTextLineCount(TextLineCount)
+				, kX1(FromChars(kX1Index)), kY1(FromChars(kY1Index)), kX2(FromChars(kX2Index)), kY2(FromChars(kY2Index)) {
+			}
+		};
+
+		// Clsns̊蓖(Defaultw͈ȍ~̑SElemAȊO͒Elem1ɓKpA[Begin Action]sŏ)
+		// `s͒OClsnN: sƎނvꍇ̂ݎ󂯕tAElemš͎ClsnN: s܂Ŏ󂯕tȂ
+		struct T_ClsnAssign {
+		private:
+			struct T_Span {
+				ksize_t Start = 0;
+				int32_t Size = 0;
+			};
+
+			std::array<T_Span, 2> Default_ = {};
+			std::array<T_Span, 2> Next_ = {};
+			std::array<bool, 2> ExistNext_ = {};
+			int32_t TargetType_ = 0;	// `s̒ǉ̎(0 = ǉȂ)
+			bool TargetDefault_ = false;
+
+		public:
+			void clear() noexcept { *this = T_ClsnAssign(); }
+
+			// ClsnN: s(BoxStart = `̊i[ʒu)
+			void Begin(int32_t Type, bool Default, ksize_t BoxStart) noexcept {
+				(Default ? Default_ : Next_)[Type - 1] = { BoxStart, 0 };
+				if (!Default) { ExistNext_[Type - 1] = true; }
+				TargetType_ = Type;
+				TargetDefault_ = Default;
+			}
+
+			// ClsnN[Y] = s(ǉ悪ꍇfalse)
+			[[nodiscard]] bool Add(int32_t Type) noexcept {
+				if (Type != TargetType_) { return false; }
+				++(TargetDefault_ ? Default_ : Next_)[Type - 1].Size;
+				return true;
+			}
+
+			[[nodiscard]] bool TargetDefault() const noexcept { return TargetDefault_; }
+
+			// Elems(Elem݂̂̎w)
+			[[nodiscard]] T_AirAnimData::T_ElemClsn Elem() noexcept {
+				const T_Span& Clsn1 = ExistNext_[0] ? Next_[0] : Default_[0];
+				const T_Span& Clsn2 = ExistNext_[1] ? Next_[1] : Default_[1];
+				const T_AirAnimData::T_ElemClsn ElemClsn = { Clsn1.Start, Clsn2.Start, Clsn1.Size, Clsn2.Size };
+				ExistNext_ = {};
+				TargetType_ = 0;
+				return ElemClsn;
+			}
+		};
+
+		struct T_AnimParam {
+		private:
+			inline static constexpr int32_t kGroupNoIndex = 1;
 			inline static constexpr int32_t kImageNoIndex = 2;
 			inline static constexpr int32_t kPosXIndex = 3;
 			inline static constexpr int32_t kPosYIndex = 4;
@@ -592,71 +2162,89 @@ namespace SAELib {
 			inline static constexpr int32_t kAlphaSValueIndex = 11;
 			inline static constexpr int32_t kAlphaDValueIndex = 13;
 
-			const std::smatch& kRegexMatch;
+			// 5Ԗڂ̐lȍ~̏ȗ\ȗvf̕ ,? H? V? ,? [ADS]? N? ,? [ADS]? N? [ADS]? N?
+			inline static constexpr char kSlotComma = ',';
+			inline static constexpr char kSlotAlpha = 'A';
+			inline static constexpr char kSlotValue = '0';
+			struct T_Slot {
+				const char Type;
+				const int32_t Index;
+			};
+			inline static constexpr T_Slot kOptionSlot[] = {
+				{ kSlotComma, 0 }, { 'H', kFacingIndex }, { 'V', kVFacingIndex }, { kSlotComma, 0 },
+				{ kSlotAlpha, kAlphaIndex }, { kSlotValue, kAlphaAValueIndex }, { kSlotComma, 0 },
+				{ kSlotAlpha, kAlphaAValueIndex + 1 }, { kSlotValue, kAlphaSValueIndex },
+				{ kSlotAlpha, kAlphaSValueIndex + 1 }, { kSlotValue, kAlphaDValueIndex },
+			};
+
+			T_ErrorHandle& kErrorHandle;
+			const T_LineMatch& kLineMatch;
 			const int32_t kTextLineCount;
+			const int32_t kGroupNo;
+			const int32_t kImageNo;
 			const int32_t kSpriteNumber;	// GroupNo(65535) ImageNo(65535)
 			const int32_t kPosX;			// PosX(-2147483648`2147483647)
 			const int32_t kPosY;			// PosY(-2147483648`2147483647)
 			const int32_t kElemTime;		// ElemTime(-2147483648`2147483647)
 			const int32_t kExtraParam;		// Facing(1), VFacing(1), AlphaA(511), AlphaS(511), AlphaD(511), DummySprite=-1(1)
 		
-			[[nodiscard]] int32_t FromChars(int32_t index) const noexcept {
-				if (kRegexMatch.size() <= index || !kRegexMatch[index].matched || !kRegexMatch[index].length()) { return 0; }
+			[[nodiscard]] int32_t FromChars(int32_t index) const {
+				if (kLineMatch.size() <= static_cast<size_t>(index) || kLineMatch[index].empty()) { return 0; }
 
-				int32_t ChersValue;
-				std::from_chars_result Result = std::from_chars(&*kRegexMatch[index].first, (&*kRegexMatch[index].first) + kRegexMatch[index].length(), ChersValue);
+				int32_t ChersValue = 0;
+				std::from_chars_result Result = std::from_chars(kLineMatch[index].data(), kLineMatch[index].data() + kLineMatch[index].size(), ChersValue);
 				
 				if (Result.ec != std::errc{}) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::FromCharsConvertFailed, ChersValue, kTextLineCount);
+					kErrorHandle.SetError(ErrorMessage::FromCharsConvertFailed, ChersValue, kTextLineCount);
 					return 0;
 				}
 
 				switch (index) {
 				case kGroupNoIndex:
 					if (!CheckRange::kSpriteGroupNo.CheckRange(ChersValue)) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::SpriteGroupNoOutOfRange, ChersValue, kTextLineCount);
+						kErrorHandle.SetError(ErrorMessage::SpriteGroupNoOutOfRange, ChersValue, kTextLineCount);
 						return 0;
 					}
 					break;
 				case kImageNoIndex:
 					if (!CheckRange::kSpriteImageNo.CheckRange(ChersValue)) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::SpriteImageNoOutOfRange, ChersValue, kTextLineCount);
+						kErrorHandle.SetError(ErrorMessage::SpriteImageNoOutOfRange, ChersValue, kTextLineCount);
 						return 0;
 					}
 					break;
 				case kPosXIndex:
 					if (!CheckRange::kElemPosX.CheckRange(ChersValue)) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::ElemPosXOutOfRange, ChersValue, kTextLineCount);
+						kErrorHandle.SetError(ErrorMessage::ElemPosXOutOfRange, ChersValue, kTextLineCount);
 						return 0;
 					}
 					break;
 				case kPosYIndex:
 					if (!CheckRange::kElemPosY.CheckRange(ChersValue)) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::ElemPosYOutOfRange, ChersValue, kTextLineCount);
+						kErrorHandle.SetError(ErrorMessage::ElemPosYOutOfRange, ChersValue, kTextLineCount);
 						return 0;
 					}
 					break;
 				case kElemTimeIndex:
 					if (!CheckRange::kElemTime.CheckRange(ChersValue)) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::ElemTimeOutOfRange, ChersValue, kTextLineCount);
+						kErrorHandle.SetError(ErrorMessage::ElemTimeOutOfRange, ChersValue, kTextLineCount);
 						return 0;
 					}
 					break;
 				case kAlphaAValueIndex:
 					if (!CheckRange::kElemAlpha.CheckRange(ChersValue)) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::ElemAlphaAOutOfRange, ChersValue, kTextLineCount);
+						kErrorHandle.SetError(ErrorMessage::ElemAlphaAOutOfRange, ChersValue, kTextLineCount);
 						return 0;
 					}
 					break;
 				case kAlphaSValueIndex:
 					if (!CheckRange::kElemAlpha.CheckRange(ChersValue)) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::ElemAlphaSOutOfRange, ChersValue, kTextLineCount);
+						kErrorHandle.SetError(ErrorMessage::ElemAlphaSOutOfRange, ChersValue, kTextLineCount);
 						return 0;
 					}
 					break;
 				case kAlphaDValueIndex:
 					if (!CheckRange::kElemAlpha.CheckRange(ChersValue)) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::ElemAlphaDOutOfRange, ChersValue, kTextLineCount);
+						kErrorHandle.SetError(ErrorMessage::ElemAlphaDOutOfRange, ChersValue, kTextLineCount);
 						return 0;
 					}
 					break;
@@ -665,34 +2253,65 @@ namespace SAELib {
 				return ChersValue;
 			}
 
-			[[nodiscard]] bool FromCharsFacing() const noexcept { return (kRegexMatch[kFacingIndex] == "" ? false : true); }
-			[[nodiscard]] bool FromCharsVFacing() const noexcept { return (kRegexMatch[kVFacingIndex] == "" ? false : true); }
+			[[nodiscard]] bool FromCharsFacing() const noexcept { return !kLineMatch[kFacingIndex].empty(); }
+			[[nodiscard]] bool FromCharsVFacing() const noexcept { return !kLineMatch[kVFacingIndex].empty(); }
 
-			[[nodiscard]] int32_t FromCharsAlpha(int32_t Alpha) const noexcept {
+			[[nodiscard]] int32_t FromCharsAlpha(int32_t Alpha) const {
 				for (int32_t AlphaLoop = kAlphaIndex; AlphaLoop < kAlphaDValueIndex; AlphaLoop += 2) {
-					if (Alpha == 'A' && kRegexMatch[AlphaLoop] == "A" ||
-						Alpha == 'S' && kRegexMatch[AlphaLoop] == "S" ||
-						Alpha == 'D' && kRegexMatch[AlphaLoop] == "D") {
+					if ((Alpha == 'A' && kLineMatch[AlphaLoop] == "A") ||
+						(Alpha == 'S' && kLineMatch[AlphaLoop] == "S") ||
+						(Alpha == 'D' && kLineMatch[AlphaLoop] == "D")) {
 						return FromChars(AlphaLoop + 1);
 					}
 				}
 				return 0;
 			}
 
-			[[nodiscard]] int32_t GetGroupNo() const noexcept { return FromChars(kGroupNoIndex); }
-			[[nodiscard]] int32_t GetImageNo() const noexcept { return FromChars(kImageNoIndex); }
-			[[nodiscard]] int32_t GetPosX() const noexcept { return FromChars(kPosXIndex); }
-			[[nodiscard]] int32_t GetPosY() const noexcept { return FromChars(kPosYIndex); }
-			[[nodiscard]] int32_t GetElemTime() const noexcept { return FromChars(kElemTimeIndex); }
+			[[nodiscard]] int32_t GetGroupNo() const { return FromChars(kGroupNoIndex); }
+			[[nodiscard]] int32_t GetImageNo() const { return FromChars(kImageNoIndex); }
+			[[nodiscard]] int32_t GetPosX() const { return FromChars(kPosXIndex); }
+			[[nodiscard]] int32_t GetPosY() const { return FromChars(kPosYIndex); }
+			[[nodiscard]] int32_t GetElemTime() const { return FromChars(kElemTimeIndex); }
 			[[nodiscard]] bool GetFacing() const noexcept { return FromCharsFacing(); }
 			[[nodiscard]] bool GetVFacing() const noexcept { return FromCharsVFacing(); }
-			[[nodiscard]] int32_t GetAlphaA() const noexcept { return FromCharsAlpha('A'); }
-			[[nodiscard]] int32_t GetAlphaS() const noexcept { return FromCharsAlpha('S'); }
-			[[nodiscard]] int32_t GetAlphaD() const noexcept { return FromCharsAlpha('D'); }
-			[[nodiscard]] bool GetDummySpriteGroupNo() const noexcept { return GetGroupNo() < 0 || GetGroupNo() > 65535; }
-			[[nodiscard]] bool GetDummySpriteImageNo() const noexcept { return GetImageNo() < 0 || GetImageNo() > 65535; }
+			[[nodiscard]] int32_t GetAlphaA() const { return FromCharsAlpha('A'); }
+			[[nodiscard]] int32_t GetAlphaS() const { return FromCharsAlpha('S'); }
+			[[nodiscard]] int32_t GetAlphaD() const { return FromCharsAlpha('D'); }
+			[[nodiscard]] bool GetDummySpriteGroupNo() const noexcept { return kGroupNo < 0 || kGroupNo > 65535; }
+			[[nodiscard]] bool GetDummySpriteImageNo() const noexcept { return kImageNo < 0 || kImageNo > 65535; }
 
 		public:
+			// \s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,?\s*(H?)\s*(V?)\s*,?\s*([ADS]?)\s*(-?\d+)?\s*,?\s*([ADS]?)\s*(-?\d+)?\s*([ADS]?)\s*(-?\d+)?\s* ɑ
+			// ȗ\ȗvf͏oɍłO̓Kʒu֊蓖Ă(K\̍ōDƓʂɂȂ)
+			[[nodiscard]] static bool Scan(std::string_view TextLine, T_LineMatch& LineMatch) noexcept {
+				T_LineScanner Scanner(TextLine);
+				LineMatch = {};
+
+				for (int32_t index = kGroupNoIndex; index <= kElemTimeIndex; ++index) {
+					Scanner.SkipSpace();
+					if (index != kGroupNoIndex) {
+						if (!Scanner.Consume(',')) { return false; }
+						Scanner.SkipSpace();
+					}
+					if (!Scanner.ConsumeInteger(LineMatch[index])) { return false; }
+				}
+
+				size_t Slot = 0;
+				for (Scanner.SkipSpace(); !Scanner.End(); Scanner.SkipSpace()) {
+					const char Token = Scanner.Peek();
+					const char Type = (Token == 'A' || Token == 'S' || Token == 'D') ? kSlotAlpha
+						: (Token == '-' || T_LineScanner::IsDigit(Token)) ? kSlotValue : Token;
+
+					while (Slot < std::size(kOptionSlot) && kOptionSlot[Slot].Type != Type) { ++Slot; }
+					if (Slot == std::size(kOptionSlot)) { return false; }
+
+					std::string_view& Group = LineMatch[kOptionSlot[Slot].Index];
+					if (Type == kSlotValue ? !Scanner.ConsumeInteger(Group) : !Scanner.ConsumeChar(Group)) { return false; }
+					++Slot;
+				}
+				return true;
+			}
+
 			int32_t SpriteNumber() const noexcept { return kSpriteNumber; }
 			int32_t GroupNo() const noexcept { return Convert::DecodeSpriteGroupNo(kSpriteNumber); }
 			int32_t ImageNo() const noexcept { return Convert::DecodeSpriteImageNo(kSpriteNumber); }
@@ -708,49 +2327,659 @@ namespace SAELib {
 			int32_t DummySpriteGroupNo() const noexcept { return Convert::DecodeDummySpriteGroupNo(kExtraParam); }
 			int32_t DummySpriteImageNo() const noexcept { return Convert::DecodeDummySpriteImageNo(kExtraParam); }
 
-			T_AnimParam(std::smatch& RegexMatch, int32_t TextLineCount)
-				: kRegexMatch(RegexMatch), kTextLineCount(TextLineCount)
-				, kSpriteNumber(Convert::EncodeSpriteNumber(GetGroupNo(), GetImageNo()))
+			T_AnimParam(T_ErrorHandle& ErrorHandle, const T_LineMatch& LineMatch, int32_t TextLineCount)
+				: kErrorHandle(ErrorHandle), kLineMatch(LineMatch), kTextLineCount(TextLineCount)
+				, kGroupNo(GetGroupNo()), kImageNo(GetImageNo())
+				, kSpriteNumber(Convert::EncodeSpriteNumber(kGroupNo, kImageNo))
 				, kPosX(GetPosX()), kPosY(GetPosY()), kElemTime(GetElemTime())
 				, kExtraParam(Convert::EncodeAnimExtraParam(GetFacing(), GetVFacing(), GetAlphaA(), GetAlphaS(), GetAlphaD(), GetDummySpriteGroupNo(), GetDummySpriteImageNo()))
 			{}
 		};
 
-		struct T_LoadAirFile {
+		// ͑Ǒς(s̕Ő邽߁Aۂ̌ȏɂȂ)
+		struct T_AirPreScan {
 		private:
-			const std::string kFileName = {};
-			const std::string kFilePath = {};
-			const uintmax_t kFileSize = 0;
-			std::ifstream File = {};
-			const bool kCheckError = false;
+			inline static constexpr size_t kStreamBufferSize = size_t(1) << 16;
+			inline static constexpr std::string_view kActionBegin = "[Begin Action";
 
-			[[nodiscard]] const std::string EnsureAirExtension(const std::filesystem::path& FileName) const {
-				std::filesystem::path FixedFileName = FileName;
-				if (FixedFileName.extension() != AIRFormat::kExtension) {
-					if (!FixedFileName.extension().empty()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::InvalidAIRExtension);
+			ksize_t NumAnim_ = 0;		// s"[Begin Action"̍s([Clsn1]̌o͐Ȃ)
+			ksize_t NumElem_ = 0;		// sE'-'̍s
+			bool LineStart_ = true;		// s̋󔒂ǂݔ΂
+			size_t ActionBegin_ = 0;	// s"[Begin Action"̂v(ēnꂽꍇr)
+
+		public:
+			[[nodiscard]] ksize_t NumAnim() const noexcept { return NumAnim_; }
+			[[nodiscard]] ksize_t NumElem() const noexcept { return NumElem_; }
+
+			// ēnĂ悢(s̓rŋ؂Ă琔)
+			void Scan(std::string_view Text) noexcept {
+				const char* Current = Text.data();
+				const char* const End = Current + Text.size();
+				while (Current != End) {
+					if (ActionBegin_ != 0) {
+						if (*Current != kActionBegin[ActionBegin_]) {
+							ActionBegin_ = 0;
+							LineStart_ = false;
+							continue;
+						}
+						++Current;
+						if (++ActionBegin_ == kActionBegin.size()) {
+							++NumAnim_;
+							ActionBegin_ = 0;
+							LineStart_ = false;
+						}
+						continue;
 					}
-					FixedFileName.replace_extension(AIRFormat::kExtension);
+					if (!LineStart_) {
+						const void* const LineEnd = std::memchr(Current, '\n', static_cast<size_t>(End - Current));
+						if (LineEnd == nullptr) { return; }
+						Current = static_cast<const char*>(LineEnd) + 1;
+						LineStart_ = true;
+						continue;
+					}
+					const char c = *Current++;
+					if (T_LineScanner::IsSpace(c)) { continue; }
+					if (c == '[') {
+						ActionBegin_ = 1;
+						continue;
+					}
+					if (c == '-' || T_LineScanner::IsDigit(c)) { ++NumElem_; }
+					LineStart_ = false;
 				}
-				return FixedFileName.string();
 			}
 
-			[[nodiscard]] const std::string FindFilePathDown(const std::string& FilePath) const {
-				T_FilePathSystem AirFolder;
-				if (!FilePath.empty()) {
-					AirFolder.SetPath(FilePath);
-					if (AirFolder.ErrorCode()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::LoadAIRInvalidPath);
-					}
+			// ǂݍ݈ʒuɖ߂ȂXg[̏ꍇfalse(ςȂ)
+			[[nodiscard]] bool ScanStream(std::istream& Stream) {
+				const std::istream::pos_type Start = Stream.tellg();
+				if (Start == std::istream::pos_type(-1)) { return false; }
+				std::string Buffer(kStreamBufferSize, '\0');
+				while (Stream.read(Buffer.data(), Buffer.size()) || Stream.gcount() > 0) {
+					Scan(std::string_view(Buffer.data(), static_cast<size_t>(Stream.gcount())));
 				}
-				if (FilePath.empty() || AirFolder.ErrorCode() && !T_Config::Instance().AIRSearchPath().empty()) {
-					AirFolder.SetPath(T_Config::Instance().AIRSearchPath());
+				Stream.clear();
+				Stream.seekg(Start);
+				return !Stream.fail();
+			}
+		};
+
+		// AIReLXg̍sPʉ
+		struct T_AirTextParser {
+		private:
+			T_UnorderedMap& AnimNumberUMap_;
+			T_AirAnimData& AirAnimData_;
+			T_ErrorHandle& ErrorHandle_;
+			T_LineMatch LineMatch_ = {};
+			bool FoundAnimData_ = false;
+			bool FoundElemData_ = false;
+			int32_t AnimNumber_ = 0;
+			int32_t Loopstart_ = 0;
+			ksize_t ElemStart_ = 0;
+			int32_t ElemDataSize_ = 0;
+			int32_t NumDuplicate_ = 0;
+			T_ClsnAssign ClsnAssign_ = {};
+			ksize_t ClsnStart_ = 0;	// ͒̃Aj̋`̐擪
+			ksize_t ClsnUsed_ = 0;	// ͒̃AjElemQƂ`̖
+
+		public:
+			// ͑ΏۂɂȂ[Begin Action]ubN̋L^(͂̌Ɏgp)
+			struct T_ActionRecord {
+				int32_t AnimNumber;
+				int32_t HeaderLine;		// [Begin Action]s
+				int32_t FlushLine;		// Ajm肵s([Begin Action]sA͖)
+				int32_t AnimListIndex;	// o^AnimList̓Y(Aj̏ꍇ -1)
+			};
+
+		private:
+			std::vector<T_ActionRecord>* ActionRecord_ = nullptr;
+
+			// ͒̃Ajm(Ajԍ̓o^AnimList̕тv)
+			void FlushAnim(int32_t TextLineCount) {
+				// Ajx
+				if (FoundAnimData_ && !FoundElemData_) {
+					ErrorHandle_.SetError(ErrorMessage::EmptyAnimElem, 0, TextLineCount);
+				}
+				else if (FoundAnimData_ && ElemDataSize_) {
+					AnimNumberUMap_.Register(AnimNumber_);
+					AirAnimData_.AddAnimList(AnimNumber_, Loopstart_, ElemStart_, ElemDataSize_);
+				}
+				// ǂElemQƂȂ̋`j(Aj̏ꍇ̓Aj̋`S)
+				if (FoundAnimData_) {
+					AirAnimData_.TrimClsnBox(ElemDataSize_ ? ClsnUsed_ : ClsnStart_);
+				}
+				if (FoundAnimData_ && ActionRecord_) {
+					ActionRecord_->back().FlushLine = TextLineCount;
+					ActionRecord_->back().AnimListIndex = ElemDataSize_ ? static_cast<int32_t>(AirAnimData_.AnimList().size()) - 1 : -1;
+				}
+				FoundAnimData_ = false;
+				FoundElemData_ = false;
+				Loopstart_ = 0;
+				ElemDataSize_ = 0;
+			}
+
+			// Clsns(`͒ǉ悪ꍇ̂݊i[)
+			void ParseClsn(int32_t TextLineCount) {
+				T_ClsnParam ClsnParam(ErrorHandle_, LineMatch_, TextLineCount);
+				if (!ClsnParam.IsBox()) {
+					ClsnAssign_.Begin(ClsnParam.Type(), ClsnParam.Default(), static_cast<ksize_t>(AirAnimData_.ClsnBox().size()));
+				}
+				else if (ClsnAssign_.Add(ClsnParam.Type())) {
+					AirAnimData_.AddClsnBox(ClsnParam.X1(), ClsnParam.Y1(), ClsnParam.X2(), ClsnParam.Y2());
+				}
+			}
+
+		public:
+			void ParseLine(std::string_view TextLine, int32_t TextLineCount) {
+				// [Begin Action XXX] ̌
+				if (T_ActionBegin::Scan(TextLine, LineMatch_)) {
+					FlushAnim(TextLineCount);
+
+					T_ActionBegin ActionBegin(ErrorHandle_, LineMatch_, TextLineCount);
+
+					// Aj[Vd`FbN
+					if (ActionBegin.AnimNumber() < 0 || AnimNumberUMap_.exist(ActionBegin.AnimNumber())) {
+						if (ActionBegin.AnimNumber() >= 0) {
+							ErrorHandle_.SetError(ErrorMessage::DuplicateAnimNumber, ActionBegin.AnimNumber(), TextLineCount);
+							++NumDuplicate_;
+						}
+						return;
+					}
+					FoundAnimData_ = true;
+					FoundElemData_ = false;
+					AnimNumber_ = ActionBegin.AnimNumber();
+					ElemStart_ = AirAnimData_.NumElem();
+					ClsnAssign_.clear();
+					ClsnStart_ = static_cast<ksize_t>(AirAnimData_.ClsnBox().size());
+					ClsnUsed_ = ClsnStart_;
+					if (ActionRecord_) { ActionRecord_->push_back({ AnimNumber_, TextLineCount, TextLineCount, -1 }); }
+				}
+				else if (FoundAnimData_) {
+					// Loopstartm
+					if (!Convert::DecodeExistLoopStart(Loopstart_) && T_Loopstart::Scan(TextLine)) {
+						Loopstart_ = Convert::EncodeLoopStart(ElemDataSize_, true);
+						return;
+					}
+
+					// Aj[Vp[^̌(ElemsłȂClsnš)
+					if (!T_AnimParam::Scan(TextLine, LineMatch_)) {
+						if (T_ClsnParam::Scan(TextLine, LineMatch_)) { ParseClsn(TextLineCount); }
+						return;
+					}
+
+					FoundElemData_ = true;
+					++ElemDataSize_;
+					T_AnimParam AnimParam(ErrorHandle_, LineMatch_, TextLineCount);
+					AirAnimData_.AddElemData(AnimParam.SpriteNumber(), AnimParam.PosX(), AnimParam.PosY(), AnimParam.ElemTime(), AnimParam.ExtraParam());
+					const T_AirAnimData::T_ElemClsn ElemClsn = ClsnAssign_.Elem();
+					AirAnimData_.AddElemClsn(ElemClsn);
+					ClsnUsed_ = std::max(ClsnUsed_, ElemClsn.End());
+				}
+			}
+
+			// t@C̏
+			void Finish(int32_t TextLineCount) { FlushAnim(TextLineCount); }
+
+			// ςŔzm(͒̍Ċmۂƕʂ)
+			void reserve(const T_AirPreScan& PreScan) {
+				AnimNumberUMap_.reserve(PreScan.NumAnim());
+				AirAnimData_.reserve(PreScan.NumAnim(), PreScan.NumElem());
+			}
+
+			// Ajԍ̏dœǂݔ΂Aj
+			[[nodiscard]] int32_t NumDuplicate() const noexcept { return NumDuplicate_; }
+
+			// ȍ~[Begin Action]ubNL^
+			void RecordAction(std::vector<T_ActionRecord>& ActionRecord) noexcept { ActionRecord_ = &ActionRecord; }
+
+		public:
+			T_AirTextParser(T_UnorderedMap& AnimNumberUMap, T_AirAnimData& AirAnimData, T_ErrorHandle& ErrorHandle)
+				: AnimNumberUMap_(AnimNumberUMap), AirAnimData_(AirAnimData), ErrorHandle_(ErrorHandle) {
+			}
+		};
+
+		// eLXgsƂɉ͊֓n(t@CEEXg[ʁAstd::getlineƓs؂)
+		template <class T_Parser>
+		struct T_BasicAirTextReader {
+		private:
+			T_Parser& AirTextParser_;
+			const bool kStripCarriageReturn;
+			int32_t NumLine_ = 0;
+			uint64_t NumByte_ = 0;
+
+			void ParseLine(std::string_view TextLine) {
+				if (kStripCarriageReturn && !TextLine.empty() && TextLine.back() == '\r') {
+					TextLine.remove_suffix(1);
+				}
+				if (TextLine.empty()) { return; }
+				AirTextParser_.ParseLine(TextLine, NumLine_);
+			}
+
+		public:
+			[[nodiscard]] int32_t NumLine() const noexcept { return NumLine_; }
+			[[nodiscard]] uint64_t NumByte() const noexcept { return NumByte_; }
+
+			// eLXg̓rǂݍޏꍇɁAO܂ł̍sw
+			void StartLine(int32_t NumLine) noexcept { NumLine_ = NumLine; }
+
+			// ͒̃Aj͊m肵Ȃ(ēǂݍޏꍇɎgp)
+			void ReadBlock(std::string_view Text) {
+				NumByte_ += Text.size();
+				while (!Text.empty()) {
+					++NumLine_;
+					const size_t LineEnd = Text.find('\n');
+					const std::string_view TextLine = Text.substr(0, LineEnd);
+					Text.remove_prefix(LineEnd == std::string_view::npos ? Text.size() : LineEnd + 1);
+					ParseLine(TextLine);
+				}
+			}
+
+			// ͂ɍsi߂
+			void SkipBlock(std::string_view Text) {
+				NumByte_ += Text.size();
+				NumLine_ += static_cast<int32_t>(std::count(Text.begin(), Text.end(), '\n'));
+				if (!Text.empty() && Text.back() != '\n') { ++NumLine_; }
+			}
+
+			void Flush() { AirTextParser_.Finish(NumLine_); }
+
+			void ReadText(std::string_view Text) {
+				ReadBlock(Text);
+				Flush();
+			}
+
+			// ǂݍ݂Ɏsꍇfalse
+			[[nodiscard]] bool ReadStream(std::istream& Stream) {
+				std::string TextLine = {};
+				// ǂݎꂽŝݐ(̉š͍sƂĐȂ)
+				while (std::getline(Stream, TextLine)) {
+					++NumLine_;
+					NumByte_ += TextLine.size() + (Stream.eof() ? 0 : 1);
+					ParseLine(TextLine);
+				}
+				AirTextParser_.Finish(NumLine_);
+				return !(Stream.bad() || (Stream.fail() && !Stream.eof()));
+			}
+
+		public:
+			T_BasicAirTextReader(T_Parser& AirTextParser, bool StripCarriageReturn)
+				: AirTextParser_(AirTextParser), kStripCarriageReturn(StripCarriageReturn) {
+			}
+		};
+		using T_AirTextReader = T_BasicAirTextReader<T_AirTextParser>;
+
+		/**
+		* @brief ͂ŌĂяo֐̊
+		*
+		* @pĕKvȊ֐̂ݒ`܂(z֐ł͂ȂAT_AirVisitParserhNX̊֐𒼐ڌĂяo܂)
+		*/
+		struct T_AirVisitor {
+			// [Begin Action]s(Ajԍ̏dȄꍇ͌Ă΂ꂸAElemnȂ)
+			void BeginAction(int32_t /*AnimNumber*/, int32_t /*TextLine*/) {}
+			// Loopstarts(ElemIndex = Elem̃Aj̔ԍ)
+			void Loopstart(int32_t /*ElemIndex*/, int32_t /*TextLine*/) {}
+			// Elems(ElemIndex = Aj̔ԍ)
+			void Elem(const T_AirAnimData::T_ElemData& /*Elem*/, int32_t /*ElemIndex*/, int32_t /*TextLine*/) {}
+			// Clsn`s(ClsnType = 1 or 2ADefault = ClsnNDefault: sɑ`AKp̖`s͓nȂ)
+			void Clsn(int32_t /*ClsnType*/, bool /*Default*/, const T_AirAnimData::T_ClsnBox& /*Box*/, int32_t /*TextLine*/) {}
+			// Aj̏I([Begin Action]s̓eLXgAElemDataSize = 0 ̏ꍇ͋Aj)
+			void EndAction(int32_t /*AnimNumber*/, int32_t /*ElemDataSize*/) {}
+			// G[(s̉͒ɌĂ΂AErrorID = AIRError::ErrorID)
+			void Error(int32_t /*ErrorID*/, int32_t /*ErrorValue*/, int32_t /*ErrorLine*/) {}
+		};
+
+		// ͌ʂێA[Begin Action]ELoopstartEElemEClsnEG[Visitor֓n(Ajԍ̏dT_AirTextParserƓ)
+		template <class T_Visitor>
+		struct T_AirVisitParser {
+		private:
+			T_Visitor& Visitor_;
+			T_UnorderedMap AnimNumberUMap_ = {};	// dp(o^Ajԍ̂ݕێ)
+			T_ErrorHandle ErrorHandle_ = {};
+			T_LineMatch LineMatch_ = {};
+			bool FoundAnimData_ = false;
+			bool FoundElemData_ = false;
+			int32_t AnimNumber_ = 0;
+			int32_t Loopstart_ = 0;
+			int32_t ElemDataSize_ = 0;
+			T_ClsnAssign ClsnAssign_ = {};
+
+			void DispatchError() {
+				if (ErrorHandle_.ErrorLists().empty()) { return; }
+				for (const auto& Error : ErrorHandle_.ErrorLists()) {
+					Visitor_.Error(Error.ErrorID(), Error.ErrorValue(), Error.ErrorLine());
+				}
+				ErrorHandle_.InitErrorList();
+			}
+
+			void FlushAnim(int32_t TextLineCount) {
+				if (!FoundAnimData_) { return; }
+				// Ajx
+				if (!FoundElemData_) {
+					ErrorHandle_.SetError(ErrorMessage::EmptyAnimElem, 0, TextLineCount);
+					DispatchError();
+				}
+				else if (ElemDataSize_) {
+					AnimNumberUMap_.Register(AnimNumber_);
+				}
+				Visitor_.EndAction(AnimNumber_, ElemDataSize_);
+				FoundAnimData_ = false;
+				FoundElemData_ = false;
+				Loopstart_ = 0;
+				ElemDataSize_ = 0;
+			}
+
+			// Clsns(`̊i[ʒu͎gpȂ)
+			void ParseClsn(int32_t TextLineCount) {
+				T_ClsnParam ClsnParam(ErrorHandle_, LineMatch_, TextLineCount);
+				DispatchError();
+				if (!ClsnParam.IsBox()) {
+					ClsnAssign_.Begin(ClsnParam.Type(), ClsnParam.Default(), 0);
+				}
+				else if (ClsnAssign_.Add(ClsnParam.Type())) {
+					Visitor_.Clsn(ClsnParam.Type(), ClsnAssign_.TargetDefault(), T_AirAnimData::T_ClsnBox(ClsnParam.X1(), ClsnParam.Y1(), ClsnParam.X2(), ClsnParam.Y2()), TextLineCount);
+				}
+			}
+
+		public:
+			void ParseLine(std::string_view TextLine, int32_t TextLineCount) {
+				// [Begin Action XXX] ̌
+				if (T_ActionBegin::Scan(TextLine, LineMatch_)) {
+					FlushAnim(TextLineCount);
+
+					T_ActionBegin ActionBegin(ErrorHandle_, LineMatch_, TextLineCount);
+
+					// Aj[Vd`FbN
+					if (ActionBegin.AnimNumber() < 0 || AnimNumberUMap_.exist(ActionBegin.AnimNumber())) {
+						if (ActionBegin.AnimNumber() >= 0) {
+							ErrorHandle_.SetError(ErrorMessage::DuplicateAnimNumber, ActionBegin.AnimNumber(), TextLineCount);
+						}
+						DispatchError();
+						return;
+					}
+					DispatchError();
+					FoundAnimData_ = true;
+					FoundElemData_ = false;
+					AnimNumber_ = ActionBegin.AnimNumber();
+					ClsnAssign_.clear();
+					Visitor_.BeginAction(AnimNumber_, TextLineCount);
+				}
+				else if (FoundAnimData_) {
+					// Loopstartm
+					if (!Convert::DecodeExistLoopStart(Loopstart_) && T_Loopstart::Scan(TextLine)) {
+						Loopstart_ = Convert::EncodeLoopStart(ElemDataSize_, true);
+						Visitor_.Loopstart(ElemDataSize_, TextLineCount);
+						return;
+					}
+
+					// Aj[Vp[^̌(ElemsłȂClsnš)
+					if (!T_AnimParam::Scan(TextLine, LineMatch_)) {
+						if (T_ClsnParam::Scan(TextLine, LineMatch_)) { ParseClsn(TextLineCount); }
+						return;
+					}
+
+					FoundElemData_ = true;
+					T_AnimParam AnimParam(ErrorHandle_, LineMatch_, TextLineCount);
+					static_cast<void>(ClsnAssign_.Elem());
+					DispatchError();
+					Visitor_.Elem(T_AirAnimData::T_ElemData(AnimParam.SpriteNumber(), AnimParam.PosX(), AnimParam.PosY(), AnimParam.ElemTime(), AnimParam.ExtraParam()), ElemDataSize_, TextLineCount);
+					++ElemDataSize_;
+				}
+			}
+
+			// t@C̏
+			void Finish(int32_t TextLineCount) { FlushAnim(TextLineCount); }
+
+		public:
+			explicit T_AirVisitParser(T_Visitor& Visitor) : Visitor_(Visitor) {}
+		};
+
+		// 1AIReLXg[Begin Action]sŕĕXbhŉ͂A擪珇Ɍ
+		// Ƀ`N܂Ajԍ̏d𔻒肵AG[͍sԍ␳Č̏ԂŋL^(1Xbhŉ͂ꍇƓʂɂȂ)
+		struct T_AirParallelParser {
+		private:
+			inline static constexpr size_t kMinChunkSize = size_t(1) << 19;	// 1`N̍ŏoCg(512KB)
+
+			struct T_Chunk {
+				std::string_view Text = {};
+				T_UnorderedMap AnimNumberUMap = {};
+				T_AirAnimData AirAnimData = {};
+				T_ErrorHandle ErrorHandle = {};
+				std::vector<T_AirTextParser::T_ActionRecord> ActionRecord = {};
+				int32_t NumLine = 0;
+				std::exception_ptr Exception = {};
+			};
+
+			// ڈ̈ʒuȍ~ōŏ[Begin Action]s̐擪ŋ؂
+			[[nodiscard]] static std::vector<std::string_view> Split(std::string_view Text, size_t NumChunk) {
+				std::vector<std::string_view> ChunkText = {};
+				T_LineMatch LineMatch = {};
+				size_t ChunkStart = 0;
+				for (size_t i = 1; i < NumChunk; ++i) {
+					const size_t Target = std::max(ChunkStart + 1, Text.size() / NumChunk * i);
+					size_t LineStart = Text.find('\n', Target - 1);
+					while (LineStart != std::string_view::npos && ++LineStart < Text.size()) {
+						const size_t LineEnd = Text.find('\n', LineStart);
+						if (T_ActionBegin::Scan(Text.substr(LineStart, LineEnd == std::string_view::npos ? std::string_view::npos : LineEnd - LineStart), LineMatch)) { break; }
+						LineStart = LineEnd;
+					}
+					if (LineStart == std::string_view::npos || LineStart >= Text.size()) { break; }
+					ChunkText.push_back(Text.substr(ChunkStart, LineStart - ChunkStart));
+					ChunkStart = LineStart;
+				}
+				ChunkText.push_back(Text.substr(ChunkStart));
+				return ChunkText;
+			}
+
+			static void ParseChunk(T_Chunk& Chunk, bool StripCarriageReturn, bool LastChunk) {
+				T_AirTextParser AirTextParser(Chunk.AnimNumberUMap, Chunk.AirAnimData, Chunk.ErrorHandle);
+				T_AirTextReader AirTextReader(AirTextParser, StripCarriageReturn);
+				T_AirPreScan AirPreScan = {};
+				AirPreScan.Scan(Chunk.Text);
+				AirTextParser.reserve(AirPreScan);
+				AirTextParser.RecordAction(Chunk.ActionRecord);
+				AirTextReader.ReadBlock(Chunk.Text);
+				Chunk.NumLine = AirTextReader.NumLine();
+				// r̃`ÑAj́Ã`N[Begin Action]sŊm肵ɂ
+				AirTextParser.Finish(LastChunk ? Chunk.NumLine : Chunk.NumLine + 1);
+			}
+
+			// `N̉͌ʂ(LineOffset = `N擪O̍s)
+			static void Merge(const T_Chunk& Chunk, int32_t LineOffset, T_UnorderedMap& AnimNumberUMap, T_AirAnimData& AirAnimData, T_ErrorHandle& ErrorHandle) {
+				const auto& ErrorList = Chunk.ErrorHandle.ErrorLists();
+				size_t ErrorIndex = 0;
+				const auto SetError = [&](const T_ErrorHandle::T_ErrorList& Error) {
+					ErrorHandle.SetError(Error.ErrorID(), Error.ErrorValue(), Error.ErrorLine() + LineOffset);
+				};
+
+				for (const auto& Record : Chunk.ActionRecord) {
+					while (ErrorIndex < ErrorList.size() && ErrorList[ErrorIndex].ErrorLine() <= Record.HeaderLine) {
+						SetError(ErrorList[ErrorIndex++]);
+					}
+					if (AnimNumberUMap.exist(Record.AnimNumber)) {
+						// Õ`Nœo^ς݁FubNƓǂݔ΂AubÑG[j
+						ErrorHandle.SetError(ErrorMessage::DuplicateAnimNumber, Record.AnimNumber, Record.HeaderLine + LineOffset);
+						while (ErrorIndex < ErrorList.size() && ErrorList[ErrorIndex].ErrorLine() < Record.FlushLine) { ++ErrorIndex; }
+						if (Record.AnimListIndex < 0 && ErrorIndex < ErrorList.size() &&
+							ErrorList[ErrorIndex].ErrorID() == ErrorMessage::EmptyAnimElem && ErrorList[ErrorIndex].ErrorLine() == Record.FlushLine) {
+							++ErrorIndex;
+						}
+						continue;
+					}
+					if (Record.AnimListIndex >= 0) {
+						AnimNumberUMap.Register(Record.AnimNumber);
+						AirAnimData.AppendAnim(Chunk.AirAnimData, static_cast<ksize_t>(Record.AnimListIndex));
+					}
+				}
+				while (ErrorIndex < ErrorList.size()) {
+					SetError(ErrorList[ErrorIndex++]);
+				}
+			}
+
+		public:
+			// eLXg̃TCYƐݒ肩番߂(1̏ꍇ͕񉻂Ȃ)
+			[[nodiscard]] static size_t NumChunk(size_t TextSize, int32_t ThreadCount) noexcept {
+				const size_t NumThread = ThreadCount > 0 ? static_cast<size_t>(ThreadCount) : std::max(1u, std::thread::hardware_concurrency());
+				return std::max<size_t>(1, std::min(NumThread, TextSize / kMinChunkSize));
+			}
+
+			/**
+			* @brief 
+			*
+			* @T_AirTextReader::ReadTextƓʂAnimNumberUMapEAirAnimDataEErrorHandleɊi[܂
+			*
+			* @param std::string_view Text AIReLXg
+			* @param bool StripCarriageReturn s\r菜
+			* @param size_t NumChunk ̏(؂[Begin Action]sꍇ͏ȂȂ)
+			* @return int32_t ͂s
+			*/
+			static int32_t Parse(std::string_view Text, bool StripCarriageReturn, size_t NumChunk, T_UnorderedMap& AnimNumberUMap, T_AirAnimData& AirAnimData, T_ErrorHandle& ErrorHandle) {
+				const std::vector<std::string_view> ChunkText = Split(Text, NumChunk);
+				std::vector<T_Chunk> ChunkList(ChunkText.size());
+				for (size_t i = 0; i < ChunkList.size(); ++i) {
+					ChunkList[i].Text = ChunkText[i];
+				}
+
+				std::atomic<size_t> NextIndex = 0;
+				const auto Worker = [&]() {
+					for (size_t index = NextIndex++; index < ChunkList.size(); index = NextIndex++) {
+						try {
+							ParseChunk(ChunkList[index], StripCarriageReturn, index + 1 == ChunkList.size());
+						}
+						catch (...) {
+							ChunkList[index].Exception = std::current_exception();
+						}
+					}
+				};
+				std::vector<std::thread> WorkerList = {};
+				WorkerList.reserve(ChunkList.size() - 1);
+				for (size_t i = 1; i < ChunkList.size(); ++i) {
+					WorkerList.emplace_back(Worker);
+				}
+				Worker();
+				for (auto& Thread : WorkerList) {
+					Thread.join();
+				}
+
+				ksize_t NumAnim = 0;
+				ksize_t NumElem = 0;
+				for (const auto& Chunk : ChunkList) {
+					if (Chunk.Exception) { std::rethrow_exception(Chunk.Exception); }
+					NumAnim += static_cast<ksize_t>(Chunk.AirAnimData.AnimList().size());
+					NumElem += Chunk.AirAnimData.NumElem();
+				}
+				AnimNumberUMap.reserve(NumAnim);
+				AirAnimData.reserve(NumAnim, NumElem);
+
+				int32_t LineOffset = 0;
+				for (const auto& Chunk : ChunkList) {
+					Merge(Chunk, LineOffset, AnimNumberUMap, AirAnimData, ErrorHandle);
+					LineOffset += Chunk.NumLine;
+				}
+				return LineOffset;
+			}
+		};
+
+		// [Begin Action]sƂɃeLXg𕪊(擪ubN͍ŏ[Begin Action]O̕)
+		struct T_ActionBlockList {
+			// s\r͉͎ƓŎ菜
+			[[nodiscard]] static std::vector<std::string_view> Split(std::string_view Text, bool StripCarriageReturn) {
+				std::vector<std::string_view> BlockList = {};
+				T_LineMatch LineMatch = {};
+				size_t BlockStart = 0;
+				// s̋󔒂̌'['ŝݔ(Ss𑖍'[')
+				for (size_t Bracket = Text.find('['); Bracket != std::string_view::npos; Bracket = Text.find('[', Bracket + 1)) {
+					const size_t PrevLineEnd = Text.rfind('\n', Bracket);
+					const size_t LineStart = PrevLineEnd == std::string_view::npos ? 0 : PrevLineEnd + 1;
+					if (Text.substr(LineStart, Bracket - LineStart).find_first_not_of(" \t\v\f") != std::string_view::npos) { continue; }
+					const size_t LineEnd = std::min(Text.find('\n', Bracket), Text.size());
+					std::string_view TextLine = Text.substr(LineStart, LineEnd - LineStart);
+					if (StripCarriageReturn && !TextLine.empty() && TextLine.back() == '\r') { TextLine.remove_suffix(1); }
+					if (LineStart != BlockStart && T_ActionBegin::Scan(TextLine, LineMatch)) {
+						BlockList.push_back(Text.substr(BlockStart, LineStart - BlockStart));
+						BlockStart = LineStart;
+					}
+				}
+				if (BlockStart < Text.size()) { BlockList.push_back(Text.substr(BlockStart)); }
+				return BlockList;
+			}
+
+			// ubN̐擪s[Begin Action]sł΃Ajԍ擾(擪ubNȊO͕K[Begin Action]sn܂)
+			[[nodiscard]] static bool HeadAnimNumber(std::string_view Block, bool StripCarriageReturn, int32_t& AnimNumber) noexcept {
+				std::string_view TextLine = Block.substr(0, std::min(Block.find('\n'), Block.size()));
+				if (StripCarriageReturn && !TextLine.empty() && TextLine.back() == '\r') { TextLine.remove_suffix(1); }
+				T_LineMatch LineMatch = {};
+				if (!T_ActionBegin::Scan(TextLine, LineMatch)) { return false; }
+				return std::from_chars(LineMatch[1].data(), LineMatch[1].data() + LineMatch[1].size(), AnimNumber).ec == std::errc{};
+			}
+
+			// 8oCgPʂŏZƉEVtgȈՃnbV(ύXopAՓ˂̓TCYrłmF)
+			[[nodiscard]] static uint64_t Hash(std::string_view Text) noexcept {
+				constexpr uint64_t kMultiplier = 0x9E3779B97F4A7C15ull;
+				uint64_t Hash = 0xcbf29ce484222325ull ^ Text.size();
+				size_t Pos = 0;
+				for (; Pos + sizeof(uint64_t) <= Text.size(); Pos += sizeof(uint64_t)) {
+					uint64_t Word = 0;
+					std::memcpy(&Word, Text.data() + Pos, sizeof(Word));
+					Hash = (Hash ^ Word) * kMultiplier;
+					Hash ^= Hash >> 29;
+				}
+				uint64_t Tail = 0;
+				std::memcpy(&Tail, Text.data() + Pos, Text.size() - Pos);
+				Hash = (Hash ^ Tail) * kMultiplier;
+				return Hash ^ (Hash >> 32);
+			}
+		};
+
+		struct T_LoadAirFile {
+		private:
+			T_ErrorHandle& kErrorHandle;
+			const T_Config& kConfig;
+			const std::string kFileName = {};
+			const std::string kFilePath = {};
+			const uintmax_t kFileSize = 0;
+			std::ifstream File = {};
+			T_MappedFile MappedFile = {};
+			const bool kCheckError = false;
+			int32_t NumLine_ = 0;
+
+#ifdef _WIN32
+			inline static constexpr bool kStripCarriageReturn = true;	// eLXg[hifstreamƓ\r\nsƂĈ
+#else
+			inline static constexpr bool kStripCarriageReturn = false;
+#endif
+
+			[[nodiscard]] const std::string EnsureAirExtension(const std::filesystem::path& FileName) const {
+				std::filesystem::path FixedFileName = FileName;
+				if (FixedFileName.extension() != AIRFormat::kExtension) {
+					if (!FixedFileName.extension().empty()) {
+						kErrorHandle.SetError(ErrorMessage::InvalidAIRExtension);
+					}
+					FixedFileName.replace_extension(AIRFormat::kExtension);
+				}
+				return FixedFileName.string();
+			}
+
+			[[nodiscard]] const std::string FindFilePathDown(const std::string& FilePath) const {
+				T_FilePathSystem AirFolder;
+				if (!FilePath.empty()) {
+					AirFolder.SetPath(FilePath);
+					if (AirFolder.ErrorCode()) {
+						kErrorHandle.SetError(ErrorMessage::LoadAIRInvalidPath);
+					}
+				}
+				if (FilePath.empty() || (AirFolder.ErrorCode() && !kConfig.AIRSearchPath().empty())) {
+					AirFolder.SetPath(kConfig.AIRSearchPath());
 					if (AirFolder.ErrorCode()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::AIRSearchInvalidPath);
+						kErrorHandle.SetError(ErrorMessage::AIRSearchInvalidPath);
 					}
 				}
 				const std::filesystem::path AbsolutePath = (std::filesystem::exists(AirFolder.Path()) ? AirFolder.Path() : std::filesystem::canonical(std::filesystem::current_path()));
 
+				if (kConfig.UseFileIndex()) {
+					std::string IndexPath = T_FileIndex::Instance().Find(AbsolutePath, kFileName, kConfig.CheckFileIndexTime());
+					if (!IndexPath.empty()) { return IndexPath; }
+					kErrorHandle.SetError(ErrorMessage::AIRFileNotFound);
+					return {};
+				}
+
 				for (const auto& entry : std::filesystem::recursive_directory_iterator(
 					AbsolutePath, std::filesystem::directory_options::skip_permission_denied)) {
 					if (!entry.is_regular_file()) { continue; }
@@ -759,24 +2988,29 @@ namespace SAELib {
 					}
 				}
 
-				T_ErrorHandle::Instance().SetError(ErrorMessage::AIRFileNotFound);
+				kErrorHandle.SetError(ErrorMessage::AIRFileNotFound);
 				return {};
 			}
 
 			[[nodiscard]] bool CheckFileSize() const {
-				if (kFileSize <= UINT32_MAX) { return false; }
-				T_ErrorHandle::Instance().SetError(ErrorMessage::AIRFileSizeOver);
+				if (kFileSize <= AIRFormat::kFileSizeLimit) { return false; }
+				kErrorHandle.SetError(ErrorMessage::AIRFileSizeOver);
 				return true;
 			}
 			[[nodiscard]] bool CheckFilePath() const {
 				if (!FilePath().empty()) { return false; }
-				T_ErrorHandle::Instance().SetError(ErrorMessage::EmptyAIRFilePath);
+				kErrorHandle.SetError(ErrorMessage::EmptyAIRFilePath);
 				return true;
 			}
 			[[nodiscard]] bool CheckFileOpen() {
-				File.open(FilePath());
-				if (File.is_open()) { return false; }
-				T_ErrorHandle::Instance().SetError(ErrorMessage::OpenAIRFileFailed);
+				if (kConfig.UseMappedFile()) {
+					if (MappedFile.Map(FilePath(), static_cast<size_t>(kFileSize))) { return false; }
+				}
+				else {
+					File.open(FilePath());
+					if (File.is_open()) { return false; }
+				}
+				kErrorHandle.SetError(ErrorMessage::OpenAIRFileFailed);
 				return true;
 			}
 
@@ -787,89 +3021,575 @@ namespace SAELib {
 			[[nodiscard]] const std::string& FilePath() const noexcept { return kFilePath; }
 			[[nodiscard]] ksize_t FileSize() const noexcept { return static_cast<ksize_t>(kFileSize); }
 			[[nodiscard]] bool CheckError() const noexcept { return kCheckError; }
+			[[nodiscard]] int32_t NumLine() const noexcept { return NumLine_; }
+
+		public:
+			[[nodiscard]] static constexpr bool StripCarriageReturn() noexcept { return kStripCarriageReturn; }
+			// }bsOt@C̓e(}bvgȂꍇ͋)
+			[[nodiscard]] std::string_view MappedText() const noexcept { return MappedFile.is_open() ? MappedFile.View() : std::string_view(); }
+
+			// t@CŜeLXgƂĎ擾
+			[[nodiscard]] bool ReadText(std::string& Text) {
+				if (MappedFile.is_open()) {
+					Text.assign(MappedFile.View());
+					return true;
+				}
+				Text.assign(static_cast<size_t>(kFileSize), '\0');
+				File.read(Text.data(), static_cast<std::streamsize>(Text.size()));
+				if (File.bad()) {
+					kErrorHandle.SetError(ErrorMessage::AIRFileReadFailed);
+					return false;
+				}
+				Text.resize(static_cast<size_t>(File.gcount()));
+				return true;
+			}
+
+			// ͌ʂێAsƂɉ͊֓n(}bv1s̓ǂݍ݂̂߁Agp̓t@CTCYɈˑȂ)
+			template <class T_Parser>
+			[[nodiscard]] bool VisitAirFile(T_Parser& Parser) {
+				T_BasicAirTextReader<T_Parser> AirTextReader(Parser, kStripCarriageReturn);
+				if (MappedFile.is_open()) {
+					AirTextReader.ReadText(MappedFile.View());
+					NumLine_ = AirTextReader.NumLine();
+					return true;
+				}
+				const bool Result = AirTextReader.ReadStream(File);
+				NumLine_ = AirTextReader.NumLine();
+				if (!Result) {
+					kErrorHandle.SetError(ErrorMessage::AIRFileReadFailed);
+					return false;
+				}
+				return true;
+			}
+
+			// ͎̃G[ParseErrorHandle֋L^(t@C̃G[͓ǂݍ݌̃nh֋L^)
+			// }bvgȂꍇ̓t@CŜ1xǂݍ݁ǍςƉ͂Ɏgp
+			[[nodiscard]] bool ReadAirFile(T_UnorderedMap& AnimNumberUMap, T_AirAnimData& AirAnimData, T_ErrorHandle& ParseErrorHandle) {
+				std::string Text = {};
+				if (!MappedFile.is_open() && !ReadText(Text)) { return false; }
+				const std::string_view TextView = MappedFile.is_open() ? MappedFile.View() : std::string_view(Text);
+
+				// 傫t@C͕ĕ
+				const size_t NumChunk = T_AirParallelParser::NumChunk(static_cast<size_t>(kFileSize), kConfig.ParseThreadCount());
+				if (NumChunk > 1) {
+					NumLine_ = T_AirParallelParser::Parse(TextView, kStripCarriageReturn, NumChunk, AnimNumberUMap, AirAnimData, ParseErrorHandle);
+					return true;
+				}
+
+				// s̃Rs[炸ɒډ
+				T_AirTextParser AirTextParser(AnimNumberUMap, AirAnimData, ParseErrorHandle);
+				T_AirTextReader AirTextReader(AirTextParser, kStripCarriageReturn);
+				T_AirPreScan AirPreScan = {};
+				AirPreScan.Scan(TextView);
+				AirTextParser.reserve(AirPreScan);
+				AirTextReader.ReadText(TextView);
+				NumLine_ = AirTextReader.NumLine();
+				return true;
+			}
 
 		public:
-			[[nodiscard]] bool ReadAirFile(T_UnorderedMap& AnimNumberUMap, T_AirAnimData& AirAnimData) {
-				// K\
-				std::smatch RegexMatch;
-				const std::regex AnimationDataBegin_re(R"(\s*\[Begin Action (-?\d+)\]\s*(?:;(.*))?)");
-				const std::regex AnimationDataParam_re(R"(\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,?\s*(H?)\s*(V?)\s*,?\s*([ADS]?)\s*(-?\d+)?\s*,?\s*([ADS]?)\s*(-?\d+)?\s*([ADS]?)\s*(-?\d+)?\s*)");
-				const std::regex AnimationDataLoop_re(R"(\s*Loopstart)");
-				const std::regex AnimationDataValue_re(R"(-?\d+)");
+			T_LoadAirFile(T_ErrorHandle& ErrorHandle, const T_Config& Config, const std::string& FileName, const std::string& FilePath)
+				: kErrorHandle(ErrorHandle), kConfig(Config), kFileName(EnsureAirExtension(FileName)), kFilePath(FindFilePathDown(FilePath))
+				, kFileSize(kFilePath.empty() ? 0 : std::filesystem::file_size(kFilePath)), kCheckError(CheckFileError()) {
+			}
+		};
 
-				std::string TextLine = {};
-				int32_t TextLineCount = 0;
-				bool FoundAnimData = false;
-				bool FoundElemData = false;
-				int32_t AnimNumber = 0;
-				int32_t Loopstart = 0;
-				ksize_t ElemStart = 0;
-				int32_t ElemDataSize = 0;
-
-				while (File.good()) {
-					++TextLineCount;
-					if (!std::getline(File, TextLine) || TextLine.empty()) { continue; }
-
-					// [Begin Action XXX] ̌
-					if (std::regex_match(TextLine, RegexMatch, AnimationDataBegin_re)) {
-
-						// Ajx
-						if (FoundAnimData && !FoundElemData) {
-							T_ErrorHandle::Instance().SetError(ErrorMessage::EmptyAnimElem, 0, TextLineCount);
-						}
-						else if (ElemDataSize) {
-							AirAnimData.AddAnimList(AnimNumber, Loopstart, ElemStart, ElemDataSize);
-							Loopstart = 0;
-							ElemDataSize = 0;
-						}
+		// ͍ςAIRf[^̃LbVt@C(t@C̃pXETCYEXVECuo[Wŏƍ)
+		struct T_AirBinaryCache {
+		private:
+			struct T_Header {
+				char Magic[sizeof(AIRFormat::kCacheMagic)];
+				double Version;
+				uint64_t FileSize;
+				int64_t FileTime;
+				uint32_t PathSize;
+				ksize_t NumAnimNumber;
+				ksize_t NumAnim;
+				ksize_t NumElem;
+				ksize_t NumClsnSet;
+				ksize_t NumElemClsn;
+				ksize_t NumClsnBox;
+				uint64_t PayloadSize;	// wb_ȍ~̃oCg
+				uint64_t Checksum;		// wb_ȍ~̓ẽnbV(ݓrEjt@Čop)
+			};
 
-						T_ActionBegin ActionBegin(RegexMatch, TextLineCount);
+			// ǂݍ񂾓eRs[ɃXg[Ƃēǂ
+			struct T_ViewBuffer : std::streambuf {
+				explicit T_ViewBuffer(std::string& Text) { setg(Text.data(), Text.data(), Text.data() + Text.size()); }
+			};
 
-						// Aj[Vd`FbN
-						if (ActionBegin.AnimNumber() < 0 || AnimNumberUMap.exist(ActionBegin.AnimNumber())) {
-							if (ActionBegin.AnimNumber() >= 0) {
-								T_ErrorHandle::Instance().SetError(ErrorMessage::DuplicateAnimNumber, ActionBegin.AnimNumber(), TextLineCount);
-							}
-							FoundAnimData = false;
-							FoundElemData = false;
-							ElemDataSize = 0;
-							continue;
+			// ꎞt@C̐ڔ(vZXEXbhEĂяoƂɈقȂ)
+			[[nodiscard]] static std::string TempSuffix() {
+				static std::atomic<uint32_t> Counter = 0;
+#ifdef _WIN32
+				const uint64_t ProcessID = GetCurrentProcessId();
+#else
+				const uint64_t ProcessID = static_cast<uint64_t>(::getpid());
+#endif
+				return "." + std::to_string(ProcessID) + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + "." + std::to_string(Counter++) + ".tmp";
+			}
+
+			const std::filesystem::path kSourcePath;
+			const std::filesystem::path kCachePath;
+			const std::string kSourcePathString;
+			const uint64_t kFileSize;
+			const int64_t kFileTime;
+
+		public:
+			// ƍɎsꍇ͉ύXfalse
+			[[nodiscard]] bool Read(T_UnorderedMap& AnimNumberUMap, T_AirAnimData& AirAnimData) const {
+				std::ifstream File(kCachePath, std::ios::binary);
+				if (!File.is_open()) { return false; }
+
+				std::error_code ErrorCode = {};
+				T_Header Header = {};
+				if (!File.read(reinterpret_cast<char*>(&Header), sizeof(Header)) ||
+					std::memcmp(Header.Magic, AIRFormat::kCacheMagic, sizeof(Header.Magic)) != 0 ||
+					Header.Version != ReadAirFileFormat::kVersion || Header.FileSize != kFileSize || Header.FileTime != kFileTime ||
+					Header.PathSize != kSourcePathString.size()) {
+					return false;
+				}
+
+				// ẽnbVvȂ(ʂ݂̏ƍErœr؂ꂽꍇ)gpȂ
+				std::string Payload = {};
+				const uint64_t CacheSize = std::filesystem::file_size(kCachePath, ErrorCode);
+				if (ErrorCode || CacheSize != sizeof(Header) + Header.PayloadSize) { return false; }
+				Payload.resize(static_cast<size_t>(Header.PayloadSize));
+				if (!File.read(Payload.data(), static_cast<std::streamsize>(Payload.size())) || T_ActionBlockList::Hash(Payload) != Header.Checksum) { return false; }
+				T_ViewBuffer PayloadBuffer(Payload);
+				std::istream PayloadStream(&PayloadBuffer);
+
+				std::string SourcePath(Header.PathSize, '\0');
+				if (!PayloadStream.read(SourcePath.data(), SourcePath.size()) || SourcePath != kSourcePathString) { return false; }
+
+				std::vector<int32_t> KeyList(Header.NumAnimNumber);
+				if (!PayloadStream.read(reinterpret_cast<char*>(KeyList.data()), KeyList.size() * sizeof(int32_t))) { return false; }
+
+				// ReadBinary͎sɓr܂ł̓ecȂ
+				if (!AirAnimData.ReadBinary(PayloadStream, Header.NumAnim, Header.NumElem, Header.NumClsnSet, Header.NumElemClsn, Header.NumClsnBox)) { return false; }
+
+				AnimNumberUMap.clear();
+				AnimNumberUMap.reserve(Header.NumAnimNumber);
+				for (int32_t Key : KeyList) {
+					AnimNumberUMap.Register(Key);
+				}
+				return true;
+			}
+
+			// ꎞt@CɏoĂu(݂ɎsĂǂݍ݌ʂɂ͉eȂ)
+			void Write(const T_UnorderedMap& AnimNumberUMap, const T_AirAnimData& AirAnimData) const {
+				const std::vector<int32_t> KeyList = AnimNumberUMap.KeyList();
+				std::ostringstream PayloadStream(std::ios::binary);
+				PayloadStream.write(kSourcePathString.data(), kSourcePathString.size());
+				PayloadStream.write(reinterpret_cast<const char*>(KeyList.data()), KeyList.size() * sizeof(int32_t));
+				AirAnimData.WriteBinary(PayloadStream);
+				const std::string Payload = std::move(PayloadStream).str();
+
+				// \̂̋lߕ܂߂ď(̓et@CɏoȂ)
+				T_Header Header;
+				std::memset(&Header, 0, sizeof(Header));
+				std::memcpy(Header.Magic, AIRFormat::kCacheMagic, sizeof(Header.Magic));
+				Header.Version = ReadAirFileFormat::kVersion;
+				Header.FileSize = kFileSize;
+				Header.FileTime = kFileTime;
+				Header.PathSize = static_cast<uint32_t>(kSourcePathString.size());
+				Header.NumAnimNumber = static_cast<ksize_t>(KeyList.size());
+				Header.NumAnim = static_cast<ksize_t>(AirAnimData.AnimList().size());
+				Header.NumElem = AirAnimData.NumElem();
+				Header.NumClsnSet = static_cast<ksize_t>(AirAnimData.ClsnSet().size());
+				Header.NumElemClsn = static_cast<ksize_t>(AirAnimData.ElemClsn().size());
+				Header.NumClsnBox = static_cast<ksize_t>(AirAnimData.ClsnBox().size());
+				Header.PayloadSize = Payload.size();
+				Header.Checksum = T_ActionBlockList::Hash(Payload);
+
+				// t@C𕡐̃vZXEXbhɏoĂȂ悤Aꎞt@C͏oƂɕ
+				std::filesystem::path TempPath = kCachePath;
+				TempPath += TempSuffix();
+				{
+					std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+					if (!File.is_open()) { return; }
+					File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+					File.write(Payload.data(), static_cast<std::streamsize>(Payload.size()));
+					File.close();
+					if (File.fail()) {
+						std::error_code ErrorCode = {};
+						std::filesystem::remove(TempPath, ErrorCode);
+						return;
+					}
+				}
+
+				std::error_code ErrorCode = {};
+				std::filesystem::rename(TempPath, kCachePath, ErrorCode);
+				if (ErrorCode) { std::filesystem::remove(TempPath, ErrorCode); }
+			}
+
+		public:
+			T_AirBinaryCache(const std::string& SourcePath, uintmax_t FileSize)
+				: kSourcePath(SourcePath), kCachePath(std::string(SourcePath) + std::string(AIRFormat::kCacheExtension))
+				, kSourcePathString(SourcePath), kFileSize(FileSize), kFileTime(T_FilePathSystem::LastWriteTime(kSourcePath)) {
+			}
+		};
+
+		// ǂݍݓv(X[vbgvp)
+		struct T_LoadStats {
+			uint64_t FileSize = 0;		// AIRt@C̃oCg
+			int32_t NumLine = 0;		// ͂s(LbVǂݍ񂾏ꍇ 0)
+			int64_t LoadTime = 0;		// 쐬܂ł̑S̎(imb)
+			int64_t ParseTime = 0;		// eLXg͂܂̓LbVǂݍ݂̎(imb)
+			bool FromCache = false;		// LbVt@Cǂݍ񂾂
+			int32_t NumReusedAnim = 0;	// ReloadAIRōĉ͂ɍėpAj
+			bool FromShared = false;	// AIRǂݍݍς݂̉͌ʂL
+			int32_t NumElem = 0;		// SAjElem
+			int32_t NumUniqueElem = 0;	// i[ĂElem(d͓ëقȂElem̐AȊONumElemƓ)
+			int32_t ElemRecordSize = 0;	// i[ĂElem1̃oCg(`̏ꍇ 12AȊO 20)
+		};
+
+		// ͌ʂ̃A[i(mی1̗̈󂯎A͌ʂ̔jɂ܂Ƃ߂ĕԋp)
+		struct T_AirArena {
+		private:
+			// mیւ̗vmیƂɔr(LoadAIRBatchŕXbhgp邽)
+			// new_delete_resource̓XbhZ[tȂߔrȂ
+			struct T_SynchronizedResource final : std::pmr::memory_resource {
+				std::pmr::memory_resource* const kResource;
+				std::mutex* const kMutex;
+
+				// mی̃AhXŐU蕪r(mی͏ɓrgp)
+				[[nodiscard]] static std::mutex& Mutex(const std::pmr::memory_resource* Resource) {
+					static std::array<std::mutex, 16> instance;
+					return instance[(reinterpret_cast<uintptr_t>(Resource) >> 4) % instance.size()];
+				}
+				void* do_allocate(size_t Bytes, size_t Alignment) override {
+					if (!kMutex) { return kResource->allocate(Bytes, Alignment); }
+					std::lock_guard<std::mutex> Lock(*kMutex);
+					return kResource->allocate(Bytes, Alignment);
+				}
+				void do_deallocate(void* Ptr, size_t Bytes, size_t Alignment) override {
+					if (!kMutex) {
+						kResource->deallocate(Ptr, Bytes, Alignment);
+						return;
+					}
+					std::lock_guard<std::mutex> Lock(*kMutex);
+					kResource->deallocate(Ptr, Bytes, Alignment);
+				}
+				[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& Other) const noexcept override { return this == &Other; }
+
+				explicit T_SynchronizedResource(std::pmr::memory_resource* Resource) noexcept
+					: kResource(Resource), kMutex(Resource == std::pmr::new_delete_resource() ? nullptr : &Mutex(Resource)) {
+				}
+			};
+
+			// z񂲂Ƃ̋E
+			inline static constexpr size_t kAlignmentPadding = 256;
+
+			T_SynchronizedResource Upstream_;
+			std::pmr::monotonic_buffer_resource Resource_;
+
+		public:
+			[[nodiscard]] std::pmr::memory_resource* Resource() noexcept { return &Resource_; }
+
+			T_AirArena(std::pmr::memory_resource* Upstream, size_t Size) : Upstream_(Upstream), Resource_(Size + kAlignmentPadding, &Upstream_) {}
+			T_AirArena(const T_AirArena&) = delete;
+			T_AirArena& operator=(const T_AirArena&) = delete;
+		};
+
+		// x͗p[Begin Action]ubN(eLXgێAubNElem͍ŏ̎QƎɉ͂)
+		struct T_AirLazyIndex {
+		private:
+			struct T_Action {
+				int32_t AnimNumber;
+				ksize_t Begin;			// [Begin Action]s̐擪ʒu
+				ksize_t Size;			// ubÑoCg([Begin Action]s̎O܂)
+				int32_t HeaderLine;		// [Begin Action]s
+				int32_t FlushLine;		// Ajm肷s([Begin Action]sA͖)
+			};
+			struct T_Slot {
+				std::once_flag Parsed = {};
+				T_AirAnimData AirAnimData = {};
+				std::vector<T_ErrorHandle::T_ErrorList> ErrorList = {};	// Elems̃G[(QƂAIRf[^ƂɁAŏ̎QƎɋL^)
+			};
+
+			const std::string kText;
+			const bool kStripCarriageReturn;
+			std::vector<T_Action> Action_ = {};
+			std::unique_ptr<T_Slot[]> Slot_ = {};
+			mutable std::atomic<size_t> ParsedSize_ = 0;
+
+			[[nodiscard]] static std::mutex& ErrorMutex() {
+				static std::mutex instance;
+				return instance;
+			}
+
+			// ubN͂ăAj1̃f[^쐬(os̃G[͑ɋL^ς݂̂ߏ)
+			void Parse(ksize_t index) const {
+				const T_Action& Action = Action_[index];
+				T_UnorderedMap AnimNumberUMap = {};
+				T_AirAnimData AirAnimData = {};
+				T_ErrorHandle ActionErrorHandle = {};
+				T_AirTextParser AirTextParser(AnimNumberUMap, AirAnimData, ActionErrorHandle);
+				T_AirTextReader AirTextReader(AirTextParser, kStripCarriageReturn);
+				AirTextReader.StartLine(Action.HeaderLine - 1);
+				AirTextReader.ReadBlock(std::string_view(kText).substr(Action.Begin, Action.Size));
+				AirTextParser.Finish(Action.FlushLine);
+				for (const auto& Error : ActionErrorHandle.ErrorLists()) {
+					if (Error.ErrorLine() != Action.HeaderLine) { Slot_[index].ErrorList.push_back(Error); }
+				}
+
+				// Elem̗LmFς݂̂ߋɂ͂ȂȂAÔElem 0 ̃AjƂĈ
+				T_AirAnimData& Target = Slot_[index].AirAnimData;
+				if (AirAnimData.AnimList().empty()) { Target.AddAnimList(Action.AnimNumber, 0, 0, 0); }
+				else { Target.AppendAnim(AirAnimData, 0); }
+				Target.BuildTimeline();
+				ParsedSize_ += Target.MemorySize();
+			}
+
+		public:
+			// AIRf[^Ƃ́AeANṼG[L^ς݂̈(AIRf[^͋̕L^ς݂̏Ԃ)
+			struct T_ReplayFlag {
+			private:
+				std::unique_ptr<std::atomic<bool>[]> Flag_ = {};
+				size_t Size_ = 0;
+
+			public:
+				// ̂falseԂ(Xbh瓯ɌĂяo)
+				[[nodiscard]] bool Exchange(ksize_t index) noexcept { return Flag_[index].exchange(true); }
+
+				T_ReplayFlag() = default;
+				explicit T_ReplayFlag(size_t Size) : Flag_(std::make_unique<std::atomic<bool>[]>(Size)), Size_(Size) {}
+				T_ReplayFlag(const T_ReplayFlag& Other) : T_ReplayFlag(Other.Size_) {
+					for (size_t i = 0; i < Size_; ++i) { Flag_[i] = Other.Flag_[i].load(); }
+				}
+				T_ReplayFlag(T_ReplayFlag&&) noexcept = default;
+				T_ReplayFlag& operator=(const T_ReplayFlag& Other) { return *this = T_ReplayFlag(Other); }
+				T_ReplayFlag& operator=(T_ReplayFlag&&) noexcept = default;
+			};
+
+			/**
+			* @brief os̑
+			*
+			* @[Begin Action]s͂AElems܂ރANV̂݃Ajԍo^AnimNumberUMap֓o^܂
+			*
+			* @ʏ̉͂ƓAANV̊m莞ɓo^邽߁AElem̖ANV(Aj)͓o^ꂸAAjԍ̌̃ANVgp܂
+			*
+			* @return int32_t s
+			*/
+			int32_t Scan(T_UnorderedMap& AnimNumberUMap, T_ErrorHandle& ErrorHandle) {
+				const std::string_view Text = kText;
+				T_LineMatch LineMatch = {};
+				int32_t NumLine = 0;
+				bool OpenAction = false;	// ÕANV͈̔͂m
+				bool FoundElem = false;		// ÕANVElems邩
+
+				// ͈͂m肵AElemsΓo^(΋AjƂď)
+				const auto FlushAction = [&](size_t End) {
+					if (!OpenAction) { return; }
+					OpenAction = false;
+					if (!FoundElem) {
+						ErrorHandle.SetError(ErrorMessage::EmptyAnimElem, 0, NumLine);
+						Action_.pop_back();
+						return;
+					}
+					Action_.back().Size = static_cast<ksize_t>(End - Action_.back().Begin);
+					Action_.back().FlushLine = NumLine;
+					AnimNumberUMap.Register(Action_.back().AnimNumber);
+				};
+
+				for (size_t LineStart = 0; LineStart < Text.size();) {
+					++NumLine;
+					const size_t LineEnd = std::min(Text.find('\n', LineStart), Text.size());
+					std::string_view TextLine = Text.substr(LineStart, LineEnd - LineStart);
+					if (kStripCarriageReturn && !TextLine.empty() && TextLine.back() == '\r') { TextLine.remove_suffix(1); }
+
+					if (T_ActionBegin::Scan(TextLine, LineMatch)) {
+						FlushAction(LineStart);
+						T_ActionBegin ActionBegin(ErrorHandle, LineMatch, NumLine);
+						if (ActionBegin.AnimNumber() >= 0 && AnimNumberUMap.exist(ActionBegin.AnimNumber())) {
+							ErrorHandle.SetError(ErrorMessage::DuplicateAnimNumber, ActionBegin.AnimNumber(), NumLine);
 						}
-						AnimNumberUMap.Register(ActionBegin.AnimNumber());
-						FoundAnimData = true;
-						FoundElemData = false;
-						AnimNumber = ActionBegin.AnimNumber();
-						ElemStart = static_cast<ksize_t>(AirAnimData.ElemData().size());
-					}
-					else if (FoundAnimData) {
-						// Loopstartm
-						if (!Convert::DecodeExistLoopStart(Loopstart) && std::regex_match(TextLine, AnimationDataLoop_re)) {
-							Loopstart = Convert::EncodeLoopStart(ElemDataSize, true);
-							continue;
+						else if (ActionBegin.AnimNumber() >= 0) {
+							Action_.push_back({ ActionBegin.AnimNumber(), static_cast<ksize_t>(LineStart), 0, NumLine, NumLine });
+							OpenAction = true;
+							FoundElem = false;
 						}
+					}
+					else if (OpenAction && !FoundElem) {
+						FoundElem = T_AnimParam::Scan(TextLine, LineMatch);
+					}
+					LineStart = LineEnd + 1;
+				}
+				FlushAction(Text.size());
+				Slot_ = std::make_unique<T_Slot[]>(Action_.size());
+				return NumLine;
+			}
 
-						// Aj[Vp[^̌
-						if (!std::regex_match(TextLine, RegexMatch, AnimationDataParam_re)) { continue; }
+			[[nodiscard]] size_t NumAction() const noexcept { return Action_.size(); }
 
-						FoundElemData = true;
-						++ElemDataSize;
-						T_AnimParam AnimParam(RegexMatch, TextLineCount);
-						AirAnimData.AddElemData(AnimParam.SpriteNumber(), AnimParam.PosX(), AnimParam.PosY(), AnimParam.ElemTime(), AnimParam.ExtraParam());
-					}
+			// ỸAjf[^(͂̏ꍇ͉́AXbh瓯ɌĂяo)
+			// Elems̃G[́AReplayFlag̎傪߂ĎQƂErrorHandle֋L^(O𓊂ݒ̏ꍇ͂1x̂)
+			[[nodiscard]] const T_AirAnimData& Anim(ksize_t index, T_ErrorHandle& ErrorHandle, T_ReplayFlag& ReplayFlag) const {
+				std::call_once(Slot_[index].Parsed, [&]() { Parse(index); });
+				if (!Slot_[index].ErrorList.empty() && !ReplayFlag.Exchange(index)) {
+					// ʂ̃ANṼG[ƓL^֓ɏ܂Ȃ悤r
+					std::lock_guard<std::mutex> Lock(ErrorMutex());
+					ErrorHandle.ReplayError(Slot_[index].ErrorList);
 				}
+				return Slot_[index].AirAnimData;
+			}
 
-				if (File.bad() || File.fail() && !File.eof()) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::AIRFileReadFailed);
-					return false;
+			// ỸAjf[^(ParseAll̂ݎgp)
+			[[nodiscard]] const T_AirAnimData& ParsedAnim(ksize_t index) const noexcept { return Slot_[index].AirAnimData; }
+
+			void ParseAll(T_ErrorHandle& ErrorHandle, T_ReplayFlag& ReplayFlag) const {
+				for (ksize_t i = 0; i < static_cast<ksize_t>(Action_.size()); ++i) {
+					static_cast<void>(Anim(i, ErrorHandle, ReplayFlag));
 				}
+			}
 
-				return true;
+			// SANV͂AElemYɘAēWJ
+			void DecodeColumns(T_ElemColumns& Columns, T_ErrorHandle& ErrorHandle, T_ReplayFlag& ReplayFlag) const {
+				ParseAll(ErrorHandle, ReplayFlag);
+				T_AirAnimData AirAnimData = {};
+				for (ksize_t i = 0; i < static_cast<ksize_t>(Action_.size()); ++i) {
+					AirAnimData.AppendAnim(ParsedAnim(i), 0);
+				}
+				AirAnimData.DecodeColumns(Columns);
+			}
+
+			[[nodiscard]] size_t MemorySize() const noexcept {
+				return kText.capacity() + Action_.capacity() * sizeof(T_Action) + Action_.size() * sizeof(T_Slot) + ParsedSize_;
 			}
 
+			T_AirLazyIndex(std::string Text, bool StripCarriageReturn) : kText(std::move(Text)), kStripCarriageReturn(StripCarriageReturn) {}
+		};
+
+		// ͌(ǂݍ͕݊ύXAAIR狤L)
+		struct T_AirContent {
+		private:
+			std::unique_ptr<T_AirArena> Arena_ = {};	// ezɔjȂ悤擪ɒu
+
 		public:
-			T_LoadAirFile(const std::string& FileName, const std::string& FilePath)
-				: kFileName(EnsureAirExtension(FileName)), kFilePath(FindFilePathDown(FilePath))
-				, kFileSize(kFilePath.empty() ? 0 : std::filesystem::file_size(kFilePath)), kCheckError(CheckFileError()) {
+			T_UnorderedMap AnimNumberUMap = {};
+			T_AirAnimData AirAnimData = {};
+			T_SpriteIndex SpriteIndex = {};	// AIRConfig::SetUseSpriteIndexON̏ꍇ̂(x͎͍쐬Ȃ)
+			std::unique_ptr<T_AirLazyIndex> LazyIndex = {};	// x͎̂(AirAnimData͋)
+			std::vector<T_ErrorHandle::T_ErrorList> ParseErrorList = {};	// ͎̃G[(L\ɓo^ꍇ̂݁AL̓ǂݍ݂œG[L^)
+
+			T_AirContent() = default;
+			explicit T_AirContent(std::pmr::memory_resource* Resource) : AnimNumberUMap(Resource), AirAnimData(Resource), SpriteIndex(Resource) {}
+			// ͌ʂA[iɋl߂ĕ
+			T_AirContent(const T_AirContent& Source, std::unique_ptr<T_AirArena> Arena)
+				: Arena_(std::move(Arena)), AnimNumberUMap(Source.AnimNumberUMap, Arena_->Resource()), AirAnimData(Source.AirAnimData, Arena_->Resource())
+				, SpriteIndex(Source.SpriteIndex, Arena_->Resource()), ParseErrorList(Source.ParseErrorList) {
+			}
+
+			// ͌̍쐬
+			void Build(const T_Config& Config) {
+				AnimNumberUMap.BuildDenseIndex(Config.DenseIndexDensity());
+				AirAnimData.BuildTimeline();
+				if (Config.UseSpriteIndex() && !LazyIndex) { SpriteIndex.Build(AirAnimData); }
+			}
+
+			[[nodiscard]] size_t MemorySize() const noexcept {
+				return AirAnimData.MemorySize() + AnimNumberUMap.MemorySize() + SpriteIndex.MemorySize() + (LazyIndex ? LazyIndex->MemorySize() : 0)
+					+ ParseErrorList.capacity() * sizeof(T_ErrorHandle::T_ErrorList);
+			}
+			[[nodiscard]] bool UseArena() const noexcept { return Arena_ != nullptr; }
+
+			/**
+			* @brief ͐̍쐬
+			*
+			* @AIRConfig::SetUseArenaON̏ꍇ͉͒̔zƗp̃A[imۂACompactɂ܂Ƃ߂ĉ܂
+			*
+			* @param const T_Config& Config ǂݍݎ̐ݒ
+			* @param std::pmr::monotonic_buffer_resource& Scratch Ɨp̃A[i(͐ɐ錾邱)
+			* @return std::shared_ptr<T_AirContent> ̉͌
+			*/
+			[[nodiscard]] static std::shared_ptr<T_AirContent> Create(const T_Config& Config, std::pmr::monotonic_buffer_resource& Scratch) {
+				if (!Config.UseArena()) { return std::make_shared<T_AirContent>(); }
+				return std::make_shared<T_AirContent>(&Scratch);
+			}
+
+			/**
+			* @brief ͌ʂ̊m
+			*
+			* @AIRConfig::SetUseArenaON̏ꍇ͉͌ʂA[iɋlߒ̂AOFF̏ꍇ͌ςߑȔẑݐ؂l߂ĕԂ܂
+			*
+			* @AIRConfig::SetUseElemPoolESetUseNarrowElemON̏ꍇ͋lߒOɓeElem܂Ƃ߁A`ɕϊ܂
+			*
+			* @A[ỉ͌ʂ1̊mۂŔzuAŌ̎QƂOꂽ_1ŉ܂
+			*
+			* @param const std::shared_ptr<T_AirContent>& Content 쐬ς݂̉͌
+			* @param const T_Config& Config ǂݍݎ̐ݒ
+			* @return std::shared_ptr<const T_AirContent> m肵͌
+			*/
+			[[nodiscard]] static std::shared_ptr<const T_AirContent> Compact(const std::shared_ptr<T_AirContent>& Content, const T_Config& Config) {
+				if (Config.UseElemPool()) { Content->AirAnimData.PoolElemData(); }
+				if (Config.UseNarrowElem()) { Content->AirAnimData.NarrowElemData(); }
+				if (!Config.UseArena()) {
+					Content->AirAnimData.ShrinkOverReserved();
+					return Content;
+				}
+				auto Arena = std::make_unique<T_AirArena>(Config.ArenaResource(), Content->AirAnimData.DataSize() + Content->AnimNumberUMap.DataSize() + Content->SpriteIndex.DataSize());
+				return std::make_shared<const T_AirContent>(*Content, std::move(Arena));
+			}
+
+			// ǂݍݎɎQƂ̉͌
+			[[nodiscard]] static const std::shared_ptr<const T_AirContent>& Empty() {
+				static const std::shared_ptr<const T_AirContent> instance = std::make_shared<const T_AirContent>();
+				return instance;
+			}
+		};
+
+		// ǂݍݍς݉͌ʂ̋L\(pXƉ͌ʂ̌`  ͌ʁAŌAIR_ŉ)
+		struct T_SharedAirContent {
+		private:
+			T_SharedAirContent() = default;
+			~T_SharedAirContent() = default;
+			T_SharedAirContent(const T_SharedAirContent&) = delete;
+			T_SharedAirContent& operator=(const T_SharedAirContent&) = delete;
+
+		private:
+			struct T_Entry {
+				std::weak_ptr<const T_AirContent> Content = {};
+				uintmax_t FileSize = 0;
+				int64_t FileTime = 0;
+			};
+
+			std::mutex Mutex_ = {};
+			std::unordered_map<std::string, T_Entry> EntryList_ = {};
+
+			// pXɉ͌ʂ̌`߂ݒ(x́EXvCgtEElem̏dE`EA[iƂ̊mیEڎQƃe[u̖x)
+			[[nodiscard]] static std::string Key(const std::filesystem::path& FilePath, const T_Config& Config) {
+				const int32_t Layout = (Config.UseLazyParse() ? 1 : 0) | (Config.UseSpriteIndex() ? 2 : 0) | (Config.UseElemPool() ? 4 : 0) | (Config.UseNarrowElem() ? 8 : 0) | (Config.UseArena() ? 16 : 0);
+				const uintptr_t Resource = Config.UseArena() ? reinterpret_cast<uintptr_t>(Config.ArenaResource()) : 0;
+				return FilePath.lexically_normal().string() + "|" + std::to_string(Layout) + "|" + std::to_string(Config.DenseIndexDensity()) + "|" + std::to_string(Resource);
+			}
+
+		public:
+			[[nodiscard]] static T_SharedAirContent& Instance() {
+				static T_SharedAirContent instance;
+				return instance;
+			}
+
+		public:
+			// ݒŉ͂ATCYEXVv͌ʂcĂΕԂ(nullptr)
+			[[nodiscard]] std::shared_ptr<const T_AirContent> Find(const std::filesystem::path& FilePath, const T_Config& Config, uintmax_t FileSize, int64_t FileTime) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				const auto it = EntryList_.find(Key(FilePath, Config));
+				if (it == EntryList_.end() || it->second.FileSize != FileSize || it->second.FileTime != FileTime) { return nullptr; }
+				return it->second.Content.lock();
+			}
+
+			void Register(const std::filesystem::path& FilePath, const T_Config& Config, const std::shared_ptr<const T_AirContent>& Content, uintmax_t FileSize, int64_t FileTime) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				for (auto it = EntryList_.begin(); it != EntryList_.end();) {
+					it = it->second.Content.expired() ? EntryList_.erase(it) : std::next(it);
+				}
+				EntryList_[Key(FilePath, Config)] = { Content, FileSize, FileTime };
+			}
+
+			void clear() {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				EntryList_.clear();
 			}
 		};
 
@@ -877,33 +3597,335 @@ namespace SAELib {
 		private:
 			int32_t NumAnim_ = 0;
 			std::string FileName_ = {};
-			T_UnorderedMap AnimNumberUMap = {};
-			T_AirAnimData AirAnimData = {};
+			std::shared_ptr<const T_Config> Config_ = T_Config::Snapshot();	// ǂݍݎ̐ݒ̎ʂ(SetConfigŎw肵ꍇ͌Œ)
+			bool FixedConfig_ = false;
+			std::shared_ptr<const T_AirContent> Content_ = T_AirContent::Empty();	// ͌(ēǂݍݎ͍ւ邽ߋLɉeȂ)
+			mutable T_ErrorHandle ErrorHandle_ = {};	// AIRf[^̓ǂݍ݂ŔG[(LoadAIRCollectError/LoadAIRBatchAx͂̃G[܂)
+			mutable T_ErrorHandle SharedErrorHandle_ = T_ErrorHandle(T_ErrorHandle::Instance(), *Config_);	// vZXʂ̃G[ꗗւ̋L^(Config_̐ݒŗO𓊂)
+			bool CollectError_ = false;	// x͂̃G[ErrorHandle_ɋL^邩
+			mutable T_AirLazyIndex::T_ReplayFlag LazyReplayFlag_ = {};	// x͂Elems̃G[L^ς݂̃ANV(Lꂽ͌ʂłAIRf[^ƂɋL^)
+			T_LoadStats LoadStats_ = {};
+			uint32_t Generation_ = 0;	// ǂݍ݁EƂɉZ(擾ς݂AnimData/ElemData̗Lp)
+
+			// zbg[hp̓ǂݍ݌
+			struct T_ActionBlock {
+				uint64_t Hash;			// ubÑeLXg̃nbV
+				ksize_t Size;			// ubÑoCg
+				int32_t AnimListIndex;	// ͌ʂAnimList̓Y(AjɂȂȂꍇ -1)
+				bool Duplicate;			// Ajԍ̏dœǂݔ΂(ÕubNŌʂς邽ߍėpȂ)
+			};
+			std::filesystem::path SourcePath_ = {};
+			uintmax_t SourceSize_ = 0;
+			int64_t SourceTime_ = 0;
+			std::vector<T_ActionBlock> ActionBlock_ = {};
 
 			void NumAnim(int32_t value) noexcept { NumAnim_ = value; }
 			void FileName(const std::string& value) noexcept { FileName_ = value; }
+			const T_UnorderedMap& AnimNumberUMap() const noexcept { return Content_->AnimNumberUMap; }
+			const T_AirAnimData& AirAnimData() const noexcept { return Content_->AirAnimData; }
+			const T_Config& Config() const noexcept { return *Config_; }
+			T_ErrorHandle& LazyErrorHandle() const noexcept { return CollectError_ ? ErrorHandle_ : SharedErrorHandle_; }
+
+			// ǂݍ݊JnɌ݂̐ݒ̎ʂ擾(SetConfigŌŒ肵Ăꍇ͂̂܂)
+			void CaptureConfig() {
+				if (!FixedConfig_) { Config_ = T_Config::Snapshot(); }
+				SharedErrorHandle_ = T_ErrorHandle(T_ErrorHandle::Instance(), *Config_);
+			}
+
+			// eLXgێA[Begin Action]ŝݑēǂݍ݂I(Elem͎QƎɉ)
+			// KeepErrortruȅꍇ͌os̃G[͌ʂɂێ(L\ɓo^ꍇ)
+			int32_t LoadLazy(std::string Text, bool StripCarriageReturn, T_ErrorHandle& ErrorHandle, bool KeepError) {
+				const std::shared_ptr<T_AirContent> Content = std::make_shared<T_AirContent>();
+				Content->LazyIndex = std::make_unique<T_AirLazyIndex>(std::move(Text), StripCarriageReturn);
+				T_ErrorHandle ParseErrorHandle(ErrorHandle.IsThrowError());
+				const int32_t NumLine = Content->LazyIndex->Scan(Content->AnimNumberUMap, KeepError ? ParseErrorHandle : ErrorHandle);
+				if (KeepError) {
+					Content->ParseErrorList = std::vector<T_ErrorHandle::T_ErrorList>(ParseErrorHandle.ErrorLists());
+					ErrorHandle.ReplayError(Content->ParseErrorList);
+				}
+				Content->Build(Config());
+				Content_ = Content;
+				LazyReplayFlag_ = T_AirLazyIndex::T_ReplayFlag(Content->LazyIndex->NumAction());
+				return NumLine;
+			}
 
-			bool LoadAIRFile(const std::string& FileName_, const std::string& FilePath_) {
+			bool LoadAIRFile(const std::string& FileName_, const std::string& FilePath_, T_ErrorHandle& ErrorHandle) {
 				if (!empty()) { clear(); }
-				T_LoadAirFile LoadAIRFile(FileName_, FilePath_);
+				const auto LoadStart = std::chrono::steady_clock::now();
+				CollectError_ = &ErrorHandle == &ErrorHandle_;
+				T_LoadAirFile LoadAIRFile(ErrorHandle, Config(), FileName_, FilePath_);
 				if (LoadAIRFile.CheckError()) { return false; }
 
-				if (!LoadAIRFile.ReadAirFile(AnimNumberUMap, AirAnimData)) { return false; }
-			
-				FileName(LoadAIRFile.FileName());
-				NumAnim(static_cast<int32_t>(AnimNumberUMap.size()));
+				const auto ParseStart = std::chrono::steady_clock::now();
+				SourcePath_ = LoadAIRFile.FilePath();
+				SourceSize_ = LoadAIRFile.FileSize();
+				SourceTime_ = T_FilePathSystem::LastWriteTime(SourcePath_);
+				const bool UseSharedData = Config().UseSharedData();
+
+				// t@C𓯂ݒŉ͂ʂL\ɎcĂΉ͂ȗ(͎̃G[͉߂ċL^)
+				if (UseSharedData) {
+					if (std::shared_ptr<const T_AirContent> Shared = T_SharedAirContent::Instance().Find(SourcePath_, Config(), SourceSize_, SourceTime_)) {
+						ErrorHandle.ReplayError(Shared->ParseErrorList);
+						Content_ = std::move(Shared);
+						if (Content_->LazyIndex) { LazyReplayFlag_ = T_AirLazyIndex::T_ReplayFlag(Content_->LazyIndex->NumAction()); }
+						LoadStats_.FileSize = LoadAIRFile.FileSize();
+						LoadStats_.FromShared = true;
+						LoadStats_.ParseTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - ParseStart).count();
+						return FinishLoad(LoadAIRFile.FileName(), ErrorHandle, LoadStart);
+					}
+				}
+
+				if (Config().UseLazyParse()) {
+					std::string Text = {};
+					if (!LoadAIRFile.ReadText(Text)) { return false; }
+					LoadStats_.FileSize = LoadAIRFile.FileSize();
+					LoadStats_.NumLine = LoadLazy(std::move(Text), T_LoadAirFile::StripCarriageReturn(), ErrorHandle, UseSharedData);
+					LoadStats_.ParseTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - ParseStart).count();
+					if (UseSharedData) {
+						T_SharedAirContent::Instance().Register(SourcePath_, Config(), Content_, SourceSize_, SourceTime_);
+					}
+					return FinishLoad(LoadAIRFile.FileName(), ErrorHandle, LoadStart);
+				}
+
+				std::pmr::monotonic_buffer_resource Scratch = {};
+				const std::shared_ptr<T_AirContent> Content = T_AirContent::Create(Config(), Scratch);
+				// L\ɓo^ꍇ͉͎̃G[͌ʂɂێ
+				T_ErrorHandle SharedParseErrorHandle(ErrorHandle.IsThrowError());
+				T_ErrorHandle& ParseErrorHandle = UseSharedData ? SharedParseErrorHandle : ErrorHandle;
+				if (Config().UseBinaryCache()) {
+					// LbVv΃eLXg̉͂ȗA͎ɃG[΃LbV쐬
+					const T_AirBinaryCache AirBinaryCache(LoadAIRFile.FilePath(), LoadAIRFile.FileSize());
+					LoadStats_.FromCache = AirBinaryCache.Read(Content->AnimNumberUMap, Content->AirAnimData);
+					if (!LoadStats_.FromCache) {
+						const size_t NumError = ParseErrorHandle.NumError();
+						if (!LoadAIRFile.ReadAirFile(Content->AnimNumberUMap, Content->AirAnimData, ParseErrorHandle)) { return false; }
+						if (ParseErrorHandle.NumError() == NumError) {
+							AirBinaryCache.Write(Content->AnimNumberUMap, Content->AirAnimData);
+						}
+					}
+				}
+				else if (!LoadAIRFile.ReadAirFile(Content->AnimNumberUMap, Content->AirAnimData, ParseErrorHandle)) { return false; }
+				const auto ParseEnd = std::chrono::steady_clock::now();
+				if (UseSharedData) {
+					Content->ParseErrorList = std::vector<T_ErrorHandle::T_ErrorList>(SharedParseErrorHandle.ErrorLists());
+					ErrorHandle.ReplayError(Content->ParseErrorList);
+				}
+
+				LoadStats_.FileSize = LoadAIRFile.FileSize();
+				LoadStats_.NumLine = LoadAIRFile.NumLine();
+				LoadStats_.ParseTime = std::chrono::duration_cast<std::chrono::nanoseconds>(ParseEnd - ParseStart).count();
+				Content->Build(Config());
+				Content_ = T_AirContent::Compact(Content, Config());
+				if (UseSharedData) {
+					T_SharedAirContent::Instance().Register(SourcePath_, Config(), Content_, SourceSize_, SourceTime_);
+				}
+				// ͂eLXg}bsOς݂̏ꍇ̂݋L^(t@CǂݒȂ@LbVgpꍇ͏ReloadAIRŋL^)
+				if (!LoadStats_.FromCache) { RecordActionBlock(LoadAIRFile.MappedText()); }
+				return FinishLoad(LoadAIRFile.FileName(), ErrorHandle, LoadStart);
+			}
+
+			// ͂eLXg[Begin Action]ubNɕAReloadAIRōėpł悤L^
+			// e[Begin Action]ubNAnimList1vfƂȂꍇ̂݋L^(AjEdΎ͑Ŝĉ)
+			void RecordActionBlock(std::string_view TextView) {
+				ActionBlock_.clear();
+				if (TextView.empty() || Content_->LazyIndex) { return; }
+
+				std::vector<T_ActionBlock> ActionBlock = {};
+				const size_t NumAnimList = AirAnimData().AnimList().size();
+				size_t AnimListIndex = 0;
+				for (const std::string_view Block : T_ActionBlockList::Split(TextView, T_LoadAirFile::StripCarriageReturn())) {
+					int32_t AnimNumber = 0;
+					if (!T_ActionBlockList::HeadAnimNumber(Block, T_LoadAirFile::StripCarriageReturn(), AnimNumber)) {
+						ActionBlock.push_back({ T_ActionBlockList::Hash(Block), static_cast<ksize_t>(Block.size()), -1, false });
+						continue;
+					}
+					if (AnimListIndex >= NumAnimList || AirAnimData().AnimList(static_cast<ksize_t>(AnimListIndex)).AnimNumber() != AnimNumber) { return; }
+					ActionBlock.push_back({ T_ActionBlockList::Hash(Block), static_cast<ksize_t>(Block.size()), static_cast<int32_t>(AnimListIndex), false });
+					++AnimListIndex;
+				}
+				if (AnimListIndex != NumAnimList) { return; }
+				ActionBlock_ = std::move(ActionBlock);
+			}
+
+			// ǂݍ݌AIRt@CXVĂ΁AύXꂽ[Begin Action]ubN̂ݍĉ
+			bool ReloadAIRFile(T_ErrorHandle& ErrorHandle) {
+				if (SourcePath_.empty()) {
+					ErrorHandle.SetError(ErrorMessage::EmptyAIRFilePath);
+					return false;
+				}
+				std::error_code ErrorCode = {};
+				const uintmax_t FileSize = std::filesystem::file_size(SourcePath_, ErrorCode);
+				const int64_t FileTime = T_FilePathSystem::LastWriteTime(SourcePath_);
+				if (ErrorCode) {
+					ErrorHandle.SetError(ErrorMessage::OpenAIRFileFailed);
+					return false;
+				}
+				if (FileSize == SourceSize_ && FileTime == SourceTime_) { return true; }
+				if (FileSize > AIRFormat::kFileSizeLimit) {
+					ErrorHandle.SetError(ErrorMessage::AIRFileSizeOver);
+					return false;
+				}
+
+				const auto LoadStart = std::chrono::steady_clock::now();
+				std::ifstream File(SourcePath_, std::ios::binary);
+				if (!File.is_open()) {
+					ErrorHandle.SetError(ErrorMessage::OpenAIRFileFailed);
+					return false;
+				}
+				std::string Text(static_cast<size_t>(FileSize), '\0');
+				if (!File.read(Text.data(), Text.size())) {
+					ErrorHandle.SetError(ErrorMessage::AIRFileReadFailed);
+					return false;
+				}
+
+				// OƓubN͉͌ʂ𕡎ʁAȊO͉
+				std::unordered_map<uint64_t, size_t> PrevBlock = {};
+				for (size_t i = 0; i < ActionBlock_.size(); ++i) {
+					PrevBlock.try_emplace(ActionBlock_[i].Hash, i);
+				}
+
+				// L̉͌ʂ͕ύXAV͌ʂ쐬čւ
+				std::pmr::monotonic_buffer_resource Scratch = {};
+				const std::shared_ptr<T_AirContent> NewContent = T_AirContent::Create(Config(), Scratch);
+				T_UnorderedMap& NewAnimNumberUMap = NewContent->AnimNumberUMap;
+				T_AirAnimData& NewAirAnimData = NewContent->AirAnimData;
+				std::vector<T_ActionBlock> NewActionBlock = {};
+				T_AirTextParser AirTextParser(NewAnimNumberUMap, NewAirAnimData, ErrorHandle);
+				T_AirTextReader AirTextReader(AirTextParser, T_LoadAirFile::StripCarriageReturn());
+				T_AirPreScan AirPreScan = {};
+				AirPreScan.Scan(Text);
+				AirTextParser.reserve(AirPreScan);
+				int32_t NumReusedAnim = 0;
+
+				for (const std::string_view Block : T_ActionBlockList::Split(Text, T_LoadAirFile::StripCarriageReturn())) {
+					const uint64_t Hash = T_ActionBlockList::Hash(Block);
+					const ksize_t NumAnimList = static_cast<ksize_t>(NewAirAnimData.AnimList().size());
+
+					if (const auto it = PrevBlock.find(Hash); it != PrevBlock.end()) {
+						const T_ActionBlock& Prev = ActionBlock_[it->second];
+						// AjɂȂȂubN(Aj)͂̂܂ܓǂݔ΂
+						if (Prev.Size == Block.size() && Prev.AnimListIndex < 0 && !Prev.Duplicate) {
+							AirTextReader.SkipBlock(Block);
+							NewActionBlock.push_back(Prev);
+							continue;
+						}
+						if (Prev.Size == Block.size() && Prev.AnimListIndex >= 0 && !NewAnimNumberUMap.exist(AirAnimData().AnimList(Prev.AnimListIndex).AnimNumber())) {
+							AirTextReader.SkipBlock(Block);
+							NewAnimNumberUMap.Register(AirAnimData().AnimList(Prev.AnimListIndex).AnimNumber());
+							NewAirAnimData.AppendAnim(AirAnimData(), Prev.AnimListIndex);
+							NewActionBlock.push_back({ Hash, static_cast<ksize_t>(Block.size()), static_cast<int32_t>(NumAnimList), false });
+							++NumReusedAnim;
+							continue;
+						}
+					}
+
+					const int32_t NumDuplicate = AirTextParser.NumDuplicate();
+					AirTextReader.ReadBlock(Block);
+					AirTextReader.Flush();
+					const bool AddAnim = NewAirAnimData.AnimList().size() > NumAnimList;
+					NewActionBlock.push_back({ Hash, static_cast<ksize_t>(Block.size()), AddAnim ? static_cast<int32_t>(NumAnimList) : -1, AirTextParser.NumDuplicate() != NumDuplicate });
+				}
+
+				NewContent->Build(Config());
+				Content_ = T_AirContent::Compact(NewContent, Config());
+				ActionBlock_ = std::move(NewActionBlock);
+				SourceSize_ = FileSize;
+				SourceTime_ = FileTime;
+				// ύX̖ubÑG[܂܂ȂߋL\ɂ͓o^Ȃ(ɓt@CǂݍAIR߂ĉ͂ēo^)
+
+				LoadStats_ = {};
+				LoadStats_.FileSize = AirTextReader.NumByte();
+				LoadStats_.NumLine = AirTextReader.NumLine();
+				LoadStats_.NumReusedAnim = NumReusedAnim;
+				LoadStats_.ParseTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - LoadStart).count();
+				return FinishLoad(FileName(), ErrorHandle, LoadStart);
+			}
+
+			// ̃eLXgǂݍ(t@CEt@C͍sȂ)
+			bool LoadAIRText(std::string_view Text, const std::string& Name, T_ErrorHandle& ErrorHandle) {
+				if (!empty()) { clear(); }
+				const auto LoadStart = std::chrono::steady_clock::now();
+				if (Text.size() > AIRFormat::kFileSizeLimit) {
+					ErrorHandle.SetError(ErrorMessage::AIRFileSizeOver);
+					return false;
+				}
+				if (Config().UseLazyParse()) {
+					CollectError_ = &ErrorHandle == &ErrorHandle_;
+					LoadStats_.FileSize = Text.size();
+					LoadStats_.NumLine = LoadLazy(std::string(Text), true, ErrorHandle, false);
+					LoadStats_.ParseTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - LoadStart).count();
+					return FinishLoad(Name, ErrorHandle, LoadStart);
+				}
+
+				std::pmr::monotonic_buffer_resource Scratch = {};
+				const std::shared_ptr<T_AirContent> Content = T_AirContent::Create(Config(), Scratch);
+				const size_t NumChunk = T_AirParallelParser::NumChunk(Text.size(), Config().ParseThreadCount());
+				if (NumChunk > 1) {
+					LoadStats_.NumLine = T_AirParallelParser::Parse(Text, true, NumChunk, Content->AnimNumberUMap, Content->AirAnimData, ErrorHandle);
+				}
+				else {
+					T_AirTextParser AirTextParser(Content->AnimNumberUMap, Content->AirAnimData, ErrorHandle);
+					T_AirTextReader AirTextReader(AirTextParser, true);
+					T_AirPreScan AirPreScan = {};
+					AirPreScan.Scan(Text);
+					AirTextParser.reserve(AirPreScan);
+					AirTextReader.ReadText(Text);
+					LoadStats_.NumLine = AirTextReader.NumLine();
+				}
+				Content->Build(Config());
+				Content_ = T_AirContent::Compact(Content, Config());
+
+				LoadStats_.FileSize = Text.size();
+				LoadStats_.ParseTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - LoadStart).count();
+				return FinishLoad(Name, ErrorHandle, LoadStart);
+			}
+
+			// Xg[ǂݍ(t@CEt@C͍sȂ)
+			bool LoadAIRStream(std::istream& Stream, const std::string& Name, T_ErrorHandle& ErrorHandle) {
+				if (!empty()) { clear(); }
+				const auto LoadStart = std::chrono::steady_clock::now();
+
+				std::pmr::monotonic_buffer_resource Scratch = {};
+				const std::shared_ptr<T_AirContent> Content = T_AirContent::Create(Config(), Scratch);
+				T_AirTextParser AirTextParser(Content->AnimNumberUMap, Content->AirAnimData, ErrorHandle);
+				T_AirTextReader AirTextReader(AirTextParser, true);
+				T_AirPreScan AirPreScan = {};
+				if (AirPreScan.ScanStream(Stream)) { AirTextParser.reserve(AirPreScan); }
+				if (!AirTextReader.ReadStream(Stream)) {
+					clear();
+					ErrorHandle.SetError(ErrorMessage::AIRFileReadFailed);
+					return false;
+				}
+				Content->Build(Config());
+				Content_ = T_AirContent::Compact(Content, Config());
+
+				LoadStats_.FileSize = AirTextReader.NumByte();
+				LoadStats_.NumLine = AirTextReader.NumLine();
+				LoadStats_.ParseTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - LoadStart).count();
+				return FinishLoad(Name, ErrorHandle, LoadStart);
+			}
+
+			// ǂݍ݌̍쐬ƃOo
+			bool FinishLoad(const std::string& Name, T_ErrorHandle& ErrorHandle, std::chrono::steady_clock::time_point LoadStart) {
+				FileName(Name);
+				NumAnim(static_cast<int32_t>(AnimNumberUMap().size()));
+				LoadStats_.NumElem = static_cast<int32_t>(AirAnimData().NumElem());
+				LoadStats_.NumUniqueElem = static_cast<int32_t>(AirAnimData().NumStoredElem());
+				LoadStats_.ElemRecordSize = static_cast<int32_t>(AirAnimData().ElemRecordSize());
+				++Generation_;
+				LoadStats_.LoadTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - LoadStart).count();
 
 				// Oo
-				if (T_Config::Instance().CreateLogFile()) {
-					T_FilePathSystem SAELibFile(T_Config::Instance().SAELibFilePath() / (T_Config::Instance().CreateSAELibFile() ? ReadAirFileFormat::kSystemDirectoryName : ""));
+				if (Config().CreateLogFile()) {
+					T_FilePathSystem SAELibFile(Config().SAELibFilePath() / (Config().CreateSAELibFile() ? ReadAirFileFormat::kSystemDirectoryName : ""));
 					if (SAELibFile.ErrorCode()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::SAELibFolderInvalidPath);
+						ErrorHandle.SetError(ErrorMessage::SAELibFolderInvalidPath);
 						return false;
 					}
-					if (T_Config::Instance().CreateSAELibFile()) {
+					if (Config().CreateSAELibFile()) {
 						SAELibFile.CreateDirectory(SAELibFile.Path());
 						if (SAELibFile.ErrorCode()) {
-							T_ErrorHandle::Instance().SetError(ErrorMessage::CreateSAELibFolderFailed);
+							ErrorHandle.SetError(ErrorMessage::CreateSAELibFolderFailed);
 							return false;
 						}
 					}
@@ -911,21 +3933,55 @@ namespace SAELib {
 					const std::string ErrorLogFileName = std::string(ReadAirFileFormat::kErrorLogFileName) + "_" + FileName() + ".txt";
 					std::ofstream ErrorLogFile(SAELibFile.Path() / ErrorLogFileName);
 					if (!ErrorLogFile.is_open()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::CreateErrorLogFileFailed);
+						ErrorHandle.SetError(ErrorMessage::CreateErrorLogFileFailed);
 					}
-					T_ErrorHandle::Instance().WriteErrorLog(ErrorLogFile);
+					ErrorHandle.WriteErrorLog(ErrorLogFile);
 				}
 
 				return true;
 			}
 
+			// G[L^ĝ̂ɂēǂݍ(O͓ɋL^)
+			bool LoadAIRFileCollectError(const std::string& FileName_, const std::string& FilePath_) {
+				CaptureConfig();
+				ErrorHandle_.InitErrorList();
+				try {
+					return LoadAIRFile(FileName_, FilePath_, ErrorHandle_);
+				}
+				catch (const std::exception&) {
+					clear();
+					return false;
+				}
+			}
+
+			// [U[Clsn`͈̔(ClsnBox_̘Ä|C^ő)
+			struct T_ClsnRange {
+			private:
+				const T_AirAnimData::T_ClsnBox* const kBegin;
+				const T_AirAnimData::T_ClsnBox* const kEnd;
+
+			public:
+				using value_type = T_AirAnimData::T_ClsnBox;
+				using iterator = const value_type*;
+				using const_iterator = const value_type*;
+
+				iterator begin() const noexcept { return kBegin; }
+				iterator end() const noexcept { return kEnd; }
+				const value_type* data() const noexcept { return kBegin; }
+				size_t size() const noexcept { return static_cast<size_t>(kEnd - kBegin); }
+				bool empty() const noexcept { return kBegin == kEnd; }
+				const value_type& operator[](size_t index) const noexcept { return kBegin[index]; }
+
+				T_ClsnRange(const value_type* Begin, const value_type* End) noexcept : kBegin(Begin), kEnd(End) {}
+			};
+
 			// [U[T_ElemDataANZXi
 			struct T_AccessData_Elem {
 			private:
 				const T_AirAnimData* const kAirAnimDataPtr;
 				const ksize_t kElemDataIndex; // zIndex(ől̂Ƃ_~[f[^tOƂĎgp)
 
-				const auto& ParamRef() const noexcept { return kAirAnimDataPtr->ElemData(kElemDataIndex); }
+				T_AirAnimData::T_ElemData ParamRef() const noexcept { return kAirAnimDataPtr->ElemData(kElemDataIndex); }
 
 			public:
 				/**
@@ -994,6 +4050,17 @@ namespace SAELib {
 				*/
 				int32_t ElemTime() const noexcept { return (IsDummy() ? 0 : ParamRef().ElemTime()); }
 
+				/**
+				* @brief JnԂ̎擾
+				*
+				* @Aj擪琔̉摜̕\JnԂԂ܂
+				*
+				* @\Ԃ̉摜̏ꍇ int64_t̍őlA_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return int64_t ElemStartTime \Jn
+				*/
+				int64_t ElemStartTime() const noexcept { return (IsDummy() ? 0 : kAirAnimDataPtr->ElemStartTime(kElemDataIndex)); }
+
 				/**
 				* @brief ̎擾
 				*
@@ -1038,18 +4105,169 @@ namespace SAELib {
 				*/
 				int32_t AlphaS() const noexcept { return (IsDummy() ? 0 : ParamRef().AlphaS()); }
 
-				/**
-				* @brief At@lD̎擾
-				*
-				* @SAEŐݒ肵At@lDԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return int32_t AlphaD At@lD
-				*/
-				int32_t AlphaD() const noexcept { return (IsDummy() ? 0 : ParamRef().AlphaD()); }
+				/**
+				* @brief At@lD̎擾
+				*
+				* @SAEŐݒ肵At@lDԂ܂
+				*
+				* @_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return int32_t AlphaD At@lD
+				*/
+				int32_t AlphaD() const noexcept { return (IsDummy() ? 0 : ParamRef().AlphaD()); }
+
+				/**
+				* @brief U(Clsn1)̎擾
+				*
+				* @̉摜ɓKpClsn1̋`͈̔͂Ԃ܂(Clsn1Defaultɂw܂݂܂)
+				*
+				* @`ꍇE_~[f[^̏ꍇ͈͋̔͂Ԃ܂
+				*
+				* @return T_ClsnRange `͈̔
+				*/
+				T_ClsnRange Clsn1() const noexcept {
+					if (IsDummy()) { return T_ClsnRange(nullptr, nullptr); }
+					const T_AirAnimData::T_ElemClsn Clsn = kAirAnimDataPtr->ElemClsn(kElemDataIndex);
+					const T_AirAnimData::T_ClsnBox* const Begin = kAirAnimDataPtr->ClsnBox().data() + Clsn.Clsn1Start;
+					return T_ClsnRange(Begin, Begin + Clsn.Clsn1Size);
+				}
+
+				/**
+				* @brief 炢(Clsn2)̎擾
+				*
+				* @̉摜ɓKpClsn2̋`͈̔͂Ԃ܂(Clsn2Defaultɂw܂݂܂)
+				*
+				* @`ꍇE_~[f[^̏ꍇ͈͋̔͂Ԃ܂
+				*
+				* @return T_ClsnRange `͈̔
+				*/
+				T_ClsnRange Clsn2() const noexcept {
+					if (IsDummy()) { return T_ClsnRange(nullptr, nullptr); }
+					const T_AirAnimData::T_ElemClsn Clsn = kAirAnimDataPtr->ElemClsn(kElemDataIndex);
+					const T_AirAnimData::T_ClsnBox* const Begin = kAirAnimDataPtr->ClsnBox().data() + Clsn.Clsn2Start;
+					return T_ClsnRange(Begin, Begin + Clsn.Clsn2Size);
+				}
+
+				/**
+				* @brief U̖
+				*
+				* @̉摜Clsn1TargetClsn2̋`̂ꂩdȂ邩Ԃ܂(ӂڂꍇdȂƂĈ܂)
+				*
+				* @e`͔zuʒu_ƂAFacing = -1 ̏ꍇX𔽓]Ĕ肵܂(摜̐E͔ɉe܂)
+				*
+				* @ǂ炩̋`ꍇE_~[f[^̏ꍇ false Ԃ܂
+				*
+				* @param int32_t PosX ̉摜̔zuʒuX
+				* @param int32_t PosY ̉摜̔zuʒuY
+				* @param int32_t Facing ̉摜̌ (1 = F -1 = )
+				* @param const T_AccessData_Elem& Target 葊̉摜
+				* @param int32_t TargetPosX 葊̔zuʒuX
+				* @param int32_t TargetPosY 葊̔zuʒuY
+				* @param int32_t TargetFacing 葊̌ (1 = F -1 = )
+				* @return bool 茋 (false = dȂȂFtrue = dȂ)
+				*/
+				bool ClsnHit(int32_t PosX, int32_t PosY, int32_t Facing, const T_AccessData_Elem& Target, int32_t TargetPosX, int32_t TargetPosY, int32_t TargetFacing) const noexcept {
+					const T_ClsnRange Attack = Clsn1();
+					const T_ClsnRange Hurt = Target.Clsn2();
+					return T_ClsnTest::Overlap(Attack.data(), Attack.size(), PosX, PosY, Facing, Hurt.data(), Hurt.size(), TargetPosX, TargetPosY, TargetFacing);
+				}
+
+				T_AccessData_Elem(const T_AirAnimData* const AirAnimDataPtr, const ksize_t ElemDataIndex) : kAirAnimDataPtr(AirAnimDataPtr), kElemDataIndex(ElemDataIndex) {}
+			};
+
+			// [U[Elem͈͂̑ʒu(Elem̓Ŷݐi߁Ad͎QƎElemId_Ŋi[ʒu)
+			// `͎QƎɕ邽߁AElem͒lŕԂ
+			struct T_ElemIterator {
+			private:
+				const T_AirAnimData* AirAnimData_;
+				const T_AirAnimData::T_ElemData* Data_;	// ElemData_̐擪(`̏ꍇ nullptr)
+				const ksize_t* Id_;						// ElemId_̐擪(d̂)
+				std::ptrdiff_t Index_;					// Elem̓Y
+
+				T_AirAnimData::T_ElemData Elem(std::ptrdiff_t Index) const noexcept {
+					if (Data_) { return Data_[Id_ ? Id_[Index] : Index]; }
+					return AirAnimData_->ElemData(static_cast<ksize_t>(Index));
+				}
+
+			public:
+				using iterator_category = std::random_access_iterator_tag;
+				using value_type = T_AirAnimData::T_ElemData;
+				using difference_type = std::ptrdiff_t;
+				using pointer = void;
+				using reference = value_type;
+
+				reference operator*() const noexcept { return Elem(Index_); }
+				reference operator[](difference_type n) const noexcept { return Elem(Index_ + n); }
+
+				T_ElemIterator& operator++() noexcept { ++Index_; return *this; }
+				T_ElemIterator& operator--() noexcept { --Index_; return *this; }
+				T_ElemIterator operator++(int) noexcept { T_ElemIterator Prev = *this; ++Index_; return Prev; }
+				T_ElemIterator operator--(int) noexcept { T_ElemIterator Prev = *this; --Index_; return Prev; }
+				T_ElemIterator& operator+=(difference_type n) noexcept { Index_ += n; return *this; }
+				T_ElemIterator& operator-=(difference_type n) noexcept { Index_ -= n; return *this; }
+				friend T_ElemIterator operator+(T_ElemIterator It, difference_type n) noexcept { return It += n; }
+				friend T_ElemIterator operator+(difference_type n, T_ElemIterator It) noexcept { return It += n; }
+				friend T_ElemIterator operator-(T_ElemIterator It, difference_type n) noexcept { return It -= n; }
+				friend difference_type operator-(const T_ElemIterator& a, const T_ElemIterator& b) noexcept { return a.Index_ - b.Index_; }
+				friend bool operator==(const T_ElemIterator& a, const T_ElemIterator& b) noexcept { return a.Index_ == b.Index_; }
+				friend bool operator!=(const T_ElemIterator& a, const T_ElemIterator& b) noexcept { return a.Index_ != b.Index_; }
+				friend bool operator<(const T_ElemIterator& a, const T_ElemIterator& b) noexcept { return a.Index_ < b.Index_; }
+				friend bool operator>(const T_ElemIterator& a, const T_ElemIterator& b) noexcept { return a.Index_ > b.Index_; }
+				friend bool operator<=(const T_ElemIterator& a, const T_ElemIterator& b) noexcept { return a.Index_ <= b.Index_; }
+				friend bool operator>=(const T_ElemIterator& a, const T_ElemIterator& b) noexcept { return a.Index_ >= b.Index_; }
+
+				T_ElemIterator() noexcept : AirAnimData_(nullptr), Data_(nullptr), Id_(nullptr), Index_(0) {}
+				T_ElemIterator(const T_AirAnimData* AirAnimData, std::ptrdiff_t Index) noexcept
+					: AirAnimData_(AirAnimData), Data_(AirAnimData->IsNarrowElem() ? nullptr : AirAnimData->ElemData().data())
+					, Id_(AirAnimData->ElemId().empty() ? nullptr : AirAnimData->ElemId().data()), Index_(Index) {
+				}
+			};
+
+			// [U[Elem͈(Elem̓Y̘Ä𑖍AdE`ւ̕ϊĂȂElemData_A)
+			struct T_ElemRange {
+			private:
+				const T_ElemIterator kBegin;
+				const T_ElemIterator kEnd;
+				const T_AirAnimData::T_ElemData* const kData;	// ElemData_ŘAĂꍇ̂ݐ擪
+
+			public:
+				using value_type = T_AirAnimData::T_ElemData;
+				using iterator = T_ElemIterator;
+				using const_iterator = T_ElemIterator;
+
+				iterator begin() const noexcept { return kBegin; }
+				iterator end() const noexcept { return kEnd; }
+				const value_type* data() const noexcept { return empty() ? nullptr : kData; }
+				size_t size() const noexcept { return static_cast<size_t>(kEnd - kBegin); }
+				bool empty() const noexcept { return kBegin == kEnd; }
+				value_type operator[](size_t index) const noexcept { return kBegin[static_cast<std::ptrdiff_t>(index)]; }
+
+				T_ElemRange() noexcept : kBegin(), kEnd(), kData(nullptr) {}
+				// AirAnimDataElem[Start, Start + Size)
+				T_ElemRange(const T_AirAnimData& AirAnimData, ksize_t Start, int32_t Size) noexcept
+					: kBegin(&AirAnimData, Start), kEnd(kBegin + Size)
+					, kData(AirAnimData.ElemId().empty() && !AirAnimData.IsNarrowElem() ? AirAnimData.ElemData().data() + Start : nullptr) {
+				}
+			};
+
+			// [U[̃XvCgQƐ͈̔(T_SpriteIndex̘Ä|C^ő)
+			struct T_SpriteRefRange {
+			private:
+				const T_SpriteIndex::T_SpriteRef* const kBegin;
+				const T_SpriteIndex::T_SpriteRef* const kEnd;
 
-				T_AccessData_Elem(const T_AirAnimData* const AirAnimDataPtr, const ksize_t ElemDataIndex) : kAirAnimDataPtr(AirAnimDataPtr), kElemDataIndex(ElemDataIndex) {}
+			public:
+				using value_type = T_SpriteIndex::T_SpriteRef;
+				using iterator = const value_type*;
+				using const_iterator = const value_type*;
+
+				iterator begin() const noexcept { return kBegin; }
+				iterator end() const noexcept { return kEnd; }
+				size_t size() const noexcept { return static_cast<size_t>(kEnd - kBegin); }
+				bool empty() const noexcept { return kBegin == kEnd; }
+				const value_type& operator[](size_t index) const noexcept { return kBegin[index]; }
+
+				T_SpriteRefRange(const value_type* Begin, const value_type* End) noexcept : kBegin(Begin), kEnd(End) {}
 			};
 
 			// [U[T_AnimListANZXi
@@ -1057,6 +4275,7 @@ namespace SAELib {
 			private:
 				const T_AirAnimData* const kAirAnimDataPtr;
 				const ksize_t kAnimListIndex; // zIndex(ől̂Ƃ_~[f[^tOƂĎgp)
+				const bool kThrowError;			// ͈͊Ỏ摜QƂꍇɗO𓊂邩(ǂݍݎ̐ݒ)
 
 				const auto& ParamRef() const noexcept { return kAirAnimDataPtr->AnimList(kAnimListIndex); }
 
@@ -1115,13 +4334,81 @@ namespace SAELib {
 				* @return int32_t ElemDataSize Aj
 				*/
 				int32_t ElemDataSize() const noexcept { return (IsDummy() ? 0 : ParamRef().ElemDataSize()); }
+
+				/**
+				* @brief Elemz̊Jnʒu̎擾
+				*
+				* @GetElemColumnsŎ擾ẑÃAj̃f[^n܂YԂ܂(ElemDataSize()A܂)
+				*
+				* @_~[f[^̏ꍇƁAAIRConfig::SetUseLazyParseONœǂݍ񂾏ꍇ 0 Ԃ܂
+				*
+				* @return int32_t ElemDataStart Jnʒu
+				*/
+				int32_t ElemDataStart() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(ParamRef().ElemDataStart())); }
+
+				/**
+				* @brief Aj̍ĐԂ̎擾
+				*
+				* @SẲ摜̕\Ԃ̍vԂ܂
+				*
+				* @\Ԃ(-1)̉摜܂ޏꍇ -1A_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @return int64_t AnimTime Đ
+				*/
+				int64_t AnimTime() const noexcept { return (IsDummy() ? 0 : kAirAnimDataPtr->AnimTime(kAnimListIndex)); }
+
+				/**
+				* @brief w莞Ԃɕ\摜̃CfbNX擾
+				*
+				* @AjJnTicko߂_ŕ\摜̃CfbNXԂ܂
+				*
+				* @ĐԂ𒴂ꍇ̓[vJnʒu(ꍇ͐擪)JԂA\Ԃ̉摜ɓBꍇ͂̉摜Œ~܂
+				*
+				* @_~[f[^̏ꍇ 0 Ԃ܂
+				*
+				* @param int64_t Tick AjJňoߎ( 0 ƂĈ)
+				* @return int32_t index f[^zCfbNX
+				*/
+				int32_t GetElemIndexAtTime(int64_t Tick) const noexcept { return (IsDummy() ? 0 : kAirAnimDataPtr->ElemIndexAtTime(kAnimListIndex, Tick)); }
+
+				/**
+				* @brief w莞Ԃɕ\摜̃f[^փANZX
+				*
+				* @GetElemData(GetElemIndexAtTime(Tick))Ɠł
+				*
+				* @param int64_t Tick AjJňoߎ( 0 ƂĈ)
+				* @return ElemData
+				*/
+				T_AccessData_Elem GetElemDataAtTime(int64_t Tick) const { return GetElemData(GetElemIndexAtTime(Tick)); }
+
+				/**
+				* @brief S摜͈̔͂擾
+				*
+				* @̃Aj̉摜f[^擪珇ɑ͈͂Ԃ܂
+				*
+				* @vfƂ͈̔͊mFE_~[s܂
+				*
+				* @vf(ElemView)͎QƂł͂ȂlŕԂ܂(tȂǂŃCe[^𕡎ʂĂQƐ͖ɂȂ܂)
+				*
+				* @data()͊i[f[^ŘAĂꍇ̂ݐ擪Ԃ܂
+				*
+				* @AIRConfig::SetUseElemPoolESetUseNarrowElemONœǂݍ񂾏ꍇ͊i[f[^YoREϊĎQƂ邽߁Adata() nullptr Ԃ܂
+				*
+				* @_~[f[^̏ꍇ͈͋̔͂Ԃ܂
+				*
+				* @return ElemRange 摜f[^͈̔
+				*/
+				T_ElemRange elems() const noexcept {
+					if (IsDummy()) { return T_ElemRange(); }
+					return T_ElemRange(*kAirAnimDataPtr, ParamRef().ElemDataStart(), ParamRef().ElemDataSize());
+				}
 				
 				/**
 				* @brief wCfbNX̃f[^փANZX
 				*
 				* @AIRf[^֎w肵CfbNXŃANZX܂
 				*
-				* @Ώۂ݂ȂꍇAIRConfig::SetThrowError̐ݒɏ܂
+				* @Ώۂ݂Ȃꍇ͓ǂݍݎAIRConfig::SetThrowError̐ݒ(SetConfigŎw肵ꍇ͂̐ݒ)ɏ܂
 				*
 				* @param int32_t index f[^zCfbNX
 				* @retval Ώۂ݂ ElemData
@@ -1131,13 +4418,78 @@ namespace SAELib {
 					if (!IsDummy() && index >= 0 && index < ElemDataSize()) {
 						return T_AccessData_Elem(kAirAnimDataPtr, ParamRef().ElemDataStart() + index);
 					}
-					if (!T_Config::Instance().ThrowError()) {
+					if (!kThrowError) {
 						return T_AccessData_Elem(kAirAnimDataPtr, KSIZE_MAX);
 					}
-					T_ErrorHandle::Instance().ThrowError(ErrorMessage::AnimIndexNotFound, index);
+					T_ErrorHandle::ThrowError(ErrorMessage::AnimIndexNotFound, index);
+				}
+
+				T_AccessData_Anim(const T_AirAnimData* const AirAnimDataPtr, const ksize_t DataListIndex, const bool ThrowError)
+					: kAirAnimDataPtr(AirAnimDataPtr), kAnimListIndex(DataListIndex), kThrowError(ThrowError) {
+				}
+			};
+
+			// [U[Anim͈(ỶẐ݂őAQƎAnimData𐶐)
+			struct T_AnimIterator {
+			private:
+				const T_AirContent* ContentPtr_;
+				ksize_t Index_;
+				bool ThrowError_;
+
+				// x͎̓ANVƂ̃f[^Q(AnimRange쐬ɉ͍ς)
+				T_AccessData_Anim Anim(ksize_t Index) const noexcept {
+					if (ContentPtr_->LazyIndex) { return T_AccessData_Anim(&ContentPtr_->LazyIndex->ParsedAnim(Index), 0, ThrowError_); }
+					return T_AccessData_Anim(&ContentPtr_->AirAnimData, Index, ThrowError_);
 				}
 
-				T_AccessData_Anim(const T_AirAnimData* const AirAnimDataPtr, const ksize_t DataListIndex) : kAirAnimDataPtr(AirAnimDataPtr), kAnimListIndex(DataListIndex) {}
+			public:
+				using iterator_category = std::random_access_iterator_tag;
+				using value_type = T_AccessData_Anim;
+				using difference_type = std::ptrdiff_t;
+				using pointer = void;
+				using reference = T_AccessData_Anim;
+
+				reference operator*() const noexcept { return Anim(Index_); }
+				reference operator[](difference_type n) const noexcept { return Anim(static_cast<ksize_t>(Index_ + n)); }
+
+				T_AnimIterator& operator++() noexcept { ++Index_; return *this; }
+				T_AnimIterator& operator--() noexcept { --Index_; return *this; }
+				T_AnimIterator operator++(int) noexcept { T_AnimIterator Prev = *this; ++Index_; return Prev; }
+				T_AnimIterator operator--(int) noexcept { T_AnimIterator Prev = *this; --Index_; return Prev; }
+				T_AnimIterator& operator+=(difference_type n) noexcept { Index_ = static_cast<ksize_t>(Index_ + n); return *this; }
+				T_AnimIterator& operator-=(difference_type n) noexcept { Index_ = static_cast<ksize_t>(Index_ - n); return *this; }
+				friend T_AnimIterator operator+(T_AnimIterator It, difference_type n) noexcept { return It += n; }
+				friend T_AnimIterator operator+(difference_type n, T_AnimIterator It) noexcept { return It += n; }
+				friend T_AnimIterator operator-(T_AnimIterator It, difference_type n) noexcept { return It -= n; }
+				friend difference_type operator-(const T_AnimIterator& a, const T_AnimIterator& b) noexcept { return static_cast<difference_type>(a.Index_) - static_cast<difference_type>(b.Index_); }
+				friend bool operator==(const T_AnimIterator& a, const T_AnimIterator& b) noexcept { return a.Index_ == b.Index_; }
+				friend bool operator!=(const T_AnimIterator& a, const T_AnimIterator& b) noexcept { return a.Index_ != b.Index_; }
+				friend bool operator<(const T_AnimIterator& a, const T_AnimIterator& b) noexcept { return a.Index_ < b.Index_; }
+				friend bool operator>(const T_AnimIterator& a, const T_AnimIterator& b) noexcept { return a.Index_ > b.Index_; }
+				friend bool operator<=(const T_AnimIterator& a, const T_AnimIterator& b) noexcept { return a.Index_ <= b.Index_; }
+				friend bool operator>=(const T_AnimIterator& a, const T_AnimIterator& b) noexcept { return a.Index_ >= b.Index_; }
+
+				T_AnimIterator() noexcept : ContentPtr_(nullptr), Index_(0), ThrowError_(false) {}
+				T_AnimIterator(const T_AirContent* ContentPtr, ksize_t Index, bool ThrowError) noexcept : ContentPtr_(ContentPtr), Index_(Index), ThrowError_(ThrowError) {}
+			};
+
+			struct T_AnimRange {
+			private:
+				const T_AirContent* const kContentPtr;
+				const bool kThrowError;
+
+			public:
+				using value_type = T_AccessData_Anim;
+				using iterator = T_AnimIterator;
+				using const_iterator = T_AnimIterator;
+
+				iterator begin() const noexcept { return T_AnimIterator(kContentPtr, 0, kThrowError); }
+				iterator end() const noexcept { return T_AnimIterator(kContentPtr, static_cast<ksize_t>(size()), kThrowError); }
+				size_t size() const noexcept { return kContentPtr->AnimNumberUMap.size(); }
+				bool empty() const noexcept { return size() == 0; }
+				T_AccessData_Anim operator[](size_t index) const noexcept { return begin()[static_cast<std::ptrdiff_t>(index)]; }
+
+				T_AnimRange(const T_AirContent* ContentPtr, bool ThrowError) noexcept : kContentPtr(ContentPtr), kThrowError(ThrowError) {}
 			};
 
 		public:
@@ -1155,63 +4507,427 @@ namespace SAELib {
 			*
 			* @ǂݍAIRf[^̊gqt@CԂ܂
 			*
-			* @return const std::string& FileName t@C
+			* @return const std::string& FileName t@C
+			*/
+			const std::string& FileName() const noexcept { return FileName_; }
+
+			/**
+			* @brief Ajԍ̃gpʂ擾
+			*
+			* @AjԍAjf[^邽߂̍gpĂ郁̃oCg(TZ)Ԃ܂
+			*
+			* @return size_t gp(byte)
+			*/
+			size_t AnimIndexMemorySize() const noexcept { return AnimNumberUMap().MemorySize(); }
+
+			/**
+			* @brief ڎQƃe[u̎gp
+			*
+			* @Ajԍ̌ɒڎQƃe[ugpĂ邩Ԃ܂
+			*
+			* @return bool 茋 (false = nbVŌFtrue = ڎQƃe[uŌ)
+			*/
+			bool IsDenseAnimIndex() const noexcept { return AnimNumberUMap().IsDenseIndex(); }
+
+			/**
+			* @brief XvCgt̍쐬
+			*
+			* @XvCgԍAjE摜쐬ς݂Ԃ܂
+			*
+			* @return bool 茋 (false = 쐬Ftrue = 쐬ς)
+			*/
+			bool HasSpriteIndex() const noexcept { return Content_->SpriteIndex.IsBuilt(); }
+
+			/**
+			* @brief AIRf[^̃gpʂ擾
+			*
+			* @Ajf[^EĐԂ̗ݐϘaEAjԍ̍EXvCgtgpĂ郁̃oCg(TZ)Ԃ܂
+			*
+			* @return size_t gp(byte)
+			*/
+			size_t MemorySize() const noexcept { return FileName_.capacity() + Content_->MemorySize(); }
+
+			/**
+			* @brief ͌ʂ̋L擾
+			*
+			* @g܂߁A͌ʂQƂĂAIR̐Ԃ܂
+			*
+			* @AIRConfig::SetUseSharedDataON̏ꍇ̓AIRt@C̓ǂݍ݂ƁAAIR̃Rs[ŉ͌ʂL܂
+			*
+			* @AIRf[^̏ꍇ 0 Ԃ܂
+			*
+			* @return int32_t L
+			*/
+			int32_t SharedCount() const noexcept { return empty() ? 0 : static_cast<int32_t>(Content_.use_count()); }
+
+			/**
+			* @brief ǂݍݓv̎擾
+			*
+			* @Ōɓǂݍ񂾍ۂ̃t@CTCYEsE(imb)Ԃ܂
+			*
+			* @FileSize / ParseTime ŉ͂̃X[vbgvł܂
+			*
+			* @return const LoadStats& ǂݍݓv
+			*/
+			const T_LoadStats& GetLoadStats() const noexcept { return LoadStats_; }
+
+			/**
+			* @brief SElem̃p[^ڂƂ̔zŎ擾
+			*
+			* @SAjElemAO[vԍEC[WԍEWE\ԁEEAt@lƂ̘AzɓWJĕԂ܂
+			*
+			* @AjƂ̃f[^AnimData::ElemDataStart()ElemDataSize()т܂@l͊eElemData̎擾֐Ɠł
+			*
+			* @SElem܂Ƃ߂đꍇɎgp܂(SSE2/AVX2gp\Ȋł͈ꊇŃfR[h܂)
+			*
+			* @AIRConfig::SetUseLazyParseONœǂݍ񂾏ꍇ́A͂̃Ajׂĉ͂ĂCfbNXɘA܂
+			*
+			* @return ElemColumns ڂƂ̔z
+			*/
+			T_ElemColumns GetElemColumns() const {
+				T_ElemColumns Columns = {};
+				GetElemColumns(Columns);
+				return Columns;
+			}
+
+			/**
+			* @brief SElem̃p[^ڂƂ̔zŎ擾(z̍ėp)
+			*
+			* @GetElemColumns()Ɠew肵zɏ㏑܂@JԂꍇ̓mۂȗł܂
+			*
+			* @param ElemColumns& Columns o͐
+			*/
+			void GetElemColumns(T_ElemColumns& Columns) const {
+				if (Content_->LazyIndex) {
+					Content_->LazyIndex->DecodeColumns(Columns, LazyErrorHandle(), LazyReplayFlag_);
+					return;
+				}
+				AirAnimData().DecodeColumns(Columns);
+			}
+
+			/**
+			* @brief AIRf[^̏
+			*
+			* @ǂݍAIRf[^܂
+			*
+			* @note
+			*/
+			void clear() {
+				NumAnim(0);
+				FileName_.clear();
+				Content_ = T_AirContent::Empty();
+				CollectError_ = false;
+				LazyReplayFlag_ = {};
+				LoadStats_ = {};
+				SourcePath_.clear();
+				SourceSize_ = 0;
+				SourceTime_ = 0;
+				ActionBlock_.clear();
+				++Generation_;
+			}
+
+			/**
+			* @brief AIRf[^̑݊mF
+			*
+			* @ǂݍAIRf[^̋󂩂𔻒肵܂
+			*
+			* @return bool 茋 (false = f[^݁Ftrue = f[^)
+			*/
+			bool empty() const noexcept {
+				return FileName().empty() && AnimNumberUMap().empty() && AirAnimData().empty();
+			}
+
+		public:
+			using AnimData = T_AccessData_Anim;
+			using ElemData = T_AccessData_Elem;
+			using LoadStats = T_LoadStats;
+			using ElemColumns = T_ElemColumns;
+			using AnimRange = T_AnimRange;
+			using ElemRange = T_ElemRange;
+			using ElemView = T_AirAnimData::T_ElemData;
+			using ClsnRange = T_ClsnRange;
+			using ClsnBox = T_AirAnimData::T_ClsnBox;
+			using SpriteRefRange = T_SpriteRefRange;
+			using SpriteRef = T_SpriteIndex::T_SpriteRef;
+
+			T_AIRData() = default;
+
+			T_AIRData(const std::string& FileName, const std::string& FilePath = "")
+			{
+				LoadAIRFile(FileName, FilePath, SharedErrorHandle_);
+			}
+
+			/**
+			* @brief w肳ꂽAIRt@Cǂݍ
+			*
+			* @st@CqKwփt@Cēǂݍ݂܂
+			*
+			* @w莞͎w肵Kwt@C܂(AIRConfigD悳܂)
+			*
+			* @sɊ̗vf͏A㏑܂
+			*
+			* @param const std::string& FileName t@C (gq .air ͏ȗ)
+			* @param const std::string& FilePath Ώۂ̃pX (ȗ͎st@C̎qKwT)
+			* @return bool ǂݍ݌ (false = sFtrue = )
+			*/
+			bool LoadAIR(const std::string& FileName, const std::string& FilePath = "") {
+				CaptureConfig();
+				return LoadAIRFile(FileName, FilePath, SharedErrorHandle_);
+			}
+
+			/**
+			* @brief AIRf[^ǂݍ
+			*
+			* @A[JCuWJς݂AIRt@C̓eAt@Ct@Cs킸ɓǂݍ݂܂
+			*
+			* @s\n\r\n̂ǂł\܂
+			*
+			* @sɊ̗vf͏A㏑܂
+			*
+			* @param std::string_view Text AIRt@C̓e
+			* @param const std::string& Name FileName()ŕԂO (G[Ot@Cɂgp)
+			* @return bool ǂݍ݌ (false = sFtrue = )
+			*/
+			bool LoadAIRFromMemory(std::string_view Text, const std::string& Name = "") {
+				CaptureConfig();
+				return LoadAIRText(Text, Name, SharedErrorHandle_);
+			}
+
+			/**
+			* @brief Xg[AIRf[^ǂݍ
+			*
+			* @std::istreamI[܂œǂݍ݂܂@t@Ct@C͍s܂
+			*
+			* @s\n\r\n̂ǂł\܂
+			*
+			* @sɊ̗vf͏A㏑܂
+			*
+			* @param std::istream& Stream ǂݍ݌̃Xg[
+			* @param const std::string& Name FileName()ŕԂO (G[Ot@Cɂgp)
+			* @return bool ǂݍ݌ (false = sFtrue = )
+			*/
+			bool LoadAIRFromStream(std::istream& Stream, const std::string& Name = "") {
+				CaptureConfig();
+				return LoadAIRStream(Stream, Name, SharedErrorHandle_);
+			}
+
+			/**
+			* @brief ǂݍݍς݂AIRt@Cēǂݍ
+			*
+			* @LoadAIRœǂݍ񂾃t@C̃TCYXVςĂ΍ēǂݍ݂܂(ςĂȂΉ܂)
+			*
+			* @[Begin Action]Ƃ̃ubNO̓eƔrAύXꂽubN̂ݍĉ͂܂@ύX̖ubÑG[͍ēxL^܂
+			*
+			* @O̓e̓t@C}bsOŉ͂ۂƍēǂݍ݂̍ۂɋL^܂@ȊO(ʏ̃t@Cǂݍ݁ELbVEL̉͌ʁEx)œǂݍ񂾏ꍇƁAAjEAjԍ̏dŃAjɂȂȂubNꍇ́A̍ēǂݍ݂łׂčĉ͂܂
+			*
+			* @ēǂݍ݌Generation()ςAȑOɎ擾AnimData/ElemData͖ɂȂ܂
+			*
+			* @return bool ǂݍ݌ (false = sFtrue = )
+			*/
+			bool ReloadAIR() {
+				CaptureConfig();
+				return ReloadAIRFile(SharedErrorHandle_);
+			}
+
+			/**
+			* @brief f[^̐ԍ擾
+			*
+			* @ǂݍ݁Eēǂݍ݁ÊтɕςԍԂ܂
+			*
+			* @擾ƔԍقȂꍇÂƂ擾AnimData/ElemData͎gpł܂
+			*
+			* @return uint32_t Generation ԍ
+			*/
+			uint32_t Generation() const noexcept { return Generation_; }
+
+			/**
+			* @brief AIRf[^̐ݒw
+			*
+			* @ȍ~̓ǂݍ݂Ɣ͈͊OQƎ̗OݒɁAAIRConfig̐ݒł͂Ȃw肵ݒgp܂
+			*
+			* @ݒ͕ĕێ邽߁AĂяoConfigύXĂe܂
+			*
+			* @ǂݍݍς݂̃f[^ɂ͉eA̓ǂݍ݂gp܂(Oݒ̂ݒɐ؂ւ܂)
+			*
+			* @param const AIRConfig::Config& Config gpݒ (AIRConfig::GetConfigŎ擾ʂύX)
+			*/
+			void SetConfig(const T_Config& Config) {
+				Config_ = std::make_shared<const T_Config>(Config);
+				FixedConfig_ = true;
+				SharedErrorHandle_ = T_ErrorHandle(T_ErrorHandle::Instance(), *Config_);
+			}
+
+			/**
+			* @brief AIRf[^̐ݒ
+			*
+			* @SetConfig̎wAȍ~͓ǂݍ݂̂тAIRConfig̐ݒgp܂
+			*/
+			void ResetConfig() {
+				FixedConfig_ = false;
+				CaptureConfig();
+			}
+
+			/**
+			* @brief AIRf[^̐ݒ擾
+			*
+			* @߂̓ǂݍ݂Ŏgpݒ(SetConfigŎw肵ꍇ͂̐ݒ)Ԃ܂
+			*
+			* @ǂݍ݌AIRConfig̐ݒύXĂA̓ǂݍ݂܂ŕς܂
+			*
+			* @return const AIRConfig::Config& ݒ
+			*/
+			const T_Config& GetConfig() const noexcept { return Config(); }
+
+			/**
+			* @brief w肳ꂽAIRt@Cǂݍ(G[AIRf[^ƂɋL^)
+			*
+			* @LoadAIRƓ菇œǂݍ݂܂AG[̓vZXʂ̃G[ꗗł͂ȂAIRf[^ɋL^܂
+			*
+			* @G[͗OƂēɋL^AErrorListŎ擾ł܂
+			*
+			* @ʁXAIRf[^łΕ̃Xbh瓯ɌĂяo܂(ǂݍݒAIRConfig̐ݒύXĂA̓ǂݍ݂ɂ͉e܂)
+			*
+			* @param const std::string& FileName t@C (gq .air ͏ȗ)
+			* @param const std::string& FilePath Ώۂ̃pX (ȗ͎st@C̎qKwT)
+			* @return bool ǂݍ݌ (false = sFtrue = )
+			*/
+			bool LoadAIRCollectError(const std::string& FileName, const std::string& FilePath = "") {
+				return LoadAIRFileCollectError(FileName, FilePath);
+			}
+
+			/**
+			* @brief AIRt@Cɓǂݍ
+			*
+			* @t@CƌpX̑g𕡐̃XbhŕSēǂݍ݂܂
+			*
+			* @AIRListFileListƓvfɑAԂŊevfLoadAIRƓei[܂(̗vf͂̂܂܍ėp܂)
+			*
+			* @G[͗OƂēɃt@CƂɋL^AErrorListŎ擾ł܂
+			*
+			* @evf͓ǂݍ݊Jn_AIRConfig̐ݒ(SetConfigŎw肵vf͂̐ݒ)œǂݍ݂܂
+			*
+			* @param const std::vector<std::pair<std::string, std::string>>& FileList t@CƌpX̑g (pX̏ꍇLoadAIRƓT)
+			* @param std::vector<T_AIRData>& AIRList ǂݍݐ
+			* @param int32_t NumThread gpXbh (0ȉ̏ꍇ̓n[hEFA̓s)
+			* @return bool ǂݍ݌ (false = 1ȏ㎸sFtrue = ׂĐ)
+			*/
+			static bool LoadAIRBatch(const std::vector<std::pair<std::string, std::string>>& FileList, std::vector<T_AIRData>& AIRList, int32_t NumThread = 0) {
+				// ̗vfSetConfig̐ݒۂߍ蒼Ȃ
+				if (AIRList.size() != FileList.size()) {
+					AIRList.resize(FileList.size());
+				}
+				std::vector<uint8_t> LoadResult(FileList.size(), 0);
+
+				const size_t NumWorker = std::min<size_t>(FileList.size(), NumThread > 0 ? static_cast<size_t>(NumThread) : std::max(1u, std::thread::hardware_concurrency()));
+				std::atomic<size_t> NextIndex = 0;
+				const auto Worker = [&]() {
+					for (size_t index = NextIndex++; index < FileList.size(); index = NextIndex++) {
+						LoadResult[index] = AIRList[index].LoadAIRFileCollectError(FileList[index].first, FileList[index].second);
+					}
+				};
+
+				std::vector<std::thread> WorkerList = {};
+				WorkerList.reserve(NumWorker);
+				for (size_t i = 1; i < NumWorker; ++i) {
+					WorkerList.emplace_back(Worker);
+				}
+				Worker();
+				for (auto& Thread : WorkerList) {
+					Thread.join();
+				}
+
+				return std::all_of(LoadResult.begin(), LoadResult.end(), [](uint8_t Result) { return Result != 0; });
+			}
+
+			/**
+			* @brief AIRt@C𒀎
+			*
+			* @AIRf[^쐬ɁA͂[Begin Action]ELoopstartEElemEClsnEG[Visitor֓n܂
+			*
+			* @VisitorAIRVisitorpAKvȊ֐(BeginAction / Loopstart / Elem / EndAction / Error)̂ݒ`܂
+			*
+			* @}bv1sǂݍނ߁Agp̓t@CTCYɈˑ܂(Ajԍ̏dp̍̂ݕێ܂)
+			*
+			* @t@CEt@C̃G[܂߁AG[͗OƂēVisitor.Error֓n܂
+			*
+			* @param const std::string& FileName t@C (gq .air ͏ȗ)
+			* @param const std::string& FilePath Ώۂ̃pX (̏ꍇLoadAIRƓT)
+			* @param T_Visitor& Visitor ͌ʂ̎󂯎
+			* @return bool ǂݍ݌ (false = sFtrue = )
 			*/
-			const std::string& FileName() const noexcept { return FileName_; }
+			template <class T_Visitor>
+			static bool VisitAIR(const std::string& FileName, const std::string& FilePath, T_Visitor& Visitor) {
+				T_ErrorHandle ErrorHandle = {};
+				const std::shared_ptr<const T_Config> Config = T_Config::Snapshot();
+				bool Result = false;
+				try {
+					T_LoadAirFile LoadAIRFile(ErrorHandle, *Config, FileName, FilePath);
+					if (!LoadAIRFile.CheckError()) {
+						T_AirVisitParser<T_Visitor> AirVisitParser(Visitor);
+						Result = LoadAIRFile.VisitAirFile(AirVisitParser);
+					}
+				}
+				catch (const std::filesystem::filesystem_error&) {
+					ErrorHandle.SetError(ErrorMessage::OpenAIRFileFailed);
+				}
+				for (const auto& Error : ErrorHandle.ErrorLists()) {
+					Visitor.Error(Error.ErrorID(), Error.ErrorValue(), Error.ErrorLine());
+				}
+				return Result;
+			}
 
 			/**
-			* @brief AIRf[^̏
+			* @brief AIRf[^𒀎
 			*
-			* @ǂݍAIRf[^܂
+			* @VisitAIRƓAAIRf[^쐬ɉ͌ʂVisitor֓n܂(s\n\r\n̂ǂł\܂)
 			*
-			* @note
+			* @param std::string_view Text AIRt@C̓e
+			* @param T_Visitor& Visitor ͌ʂ̎󂯎
 			*/
-			void clear() {
-				NumAnim(0);
-				FileName_.clear();
-				AnimNumberUMap.clear();
-				AirAnimData.clear();
+			template <class T_Visitor>
+			static void VisitAIRFromMemory(std::string_view Text, T_Visitor& Visitor) {
+				T_AirVisitParser<T_Visitor> AirVisitParser(Visitor);
+				T_BasicAirTextReader<T_AirVisitParser<T_Visitor>> AirTextReader(AirVisitParser, true);
+				AirTextReader.ReadText(Text);
 			}
 
 			/**
-			* @brief AIRf[^̑݊mF
+			* @brief Xg[璀
 			*
-			* @ǂݍAIRf[^̋󂩂𔻒肵܂
+			* @VisitAIRƓAAIRf[^쐬ɉ͌ʂVisitor֓n܂(1sǂݍ݂܂)
 			*
-			* @return bool 茋 (false = f[^݁Ftrue = f[^)
+			* @param std::istream& Stream ǂݍ݌
+			* @param T_Visitor& Visitor ͌ʂ̎󂯎
+			* @return bool ǂݍ݌ (false = sFtrue = )
 			*/
-			bool empty() const noexcept {
-				return FileName().empty() && AnimNumberUMap.empty() && AirAnimData.empty();
-			}
-
-		public:
-			using AnimData = T_AccessData_Anim;
-			using ElemData = T_AccessData_Elem;
-
-			T_AIRData() = default;
-
-			T_AIRData(const std::string& FileName, const std::string& FilePath = "")
-			{
-				LoadAIRFile(FileName, FilePath);
+			template <class T_Visitor>
+			static bool VisitAIRFromStream(std::istream& Stream, T_Visitor& Visitor) {
+				T_AirVisitParser<T_Visitor> AirVisitParser(Visitor);
+				T_BasicAirTextReader<T_AirVisitParser<T_Visitor>> AirTextReader(AirVisitParser, true);
+				if (AirTextReader.ReadStream(Stream)) { return true; }
+				Visitor.Error(ErrorMessage::AIRFileReadFailed, 0, 0);
+				return false;
 			}
 
 			/**
-			* @brief w肳ꂽAIRt@Cǂݍ
+			* @brief AIRf[^Ƃ̃G[擾
 			*
-			* @st@CqKwփt@Cēǂݍ݂܂
-			*
-			* @w莞͎w肵Kwt@C܂(AIRConfigD悳܂)
+			* @LoadAIRCollectErrorLoadAIRBatchłAIRf[^ǂݍ񂾍ۂɔG[̈ꗗԂ܂
 			*
-			* @sɊ̗vf͏A㏑܂
+			* @LoadAIRœǂݍ񂾏ꍇ̃G[̓vZXʂ̈ꗗɋL^邽߁Aɂ͊܂܂܂
 			*
-			* @param const std::string& FileName t@C (gq .air ͏ȗ)
-			* @param const std::string& FilePath Ώۂ̃pX (ȗ͎st@C̎qKwT)
-			* @return bool ǂݍ݌ (false = sFtrue = )
+			* @return const std::vector<T_ErrorList>& ErrorList G[̈ꗗ
 			*/
-			bool LoadAIR(const std::string& FileName, const std::string& FilePath = "") {
-				return LoadAIRFile(FileName, FilePath);
+			const std::vector<T_ErrorHandle::T_ErrorList>& ErrorList() const noexcept { return ErrorHandle_.ErrorLists(); }
+
+		private:
+			// ỸAjf[^(x͎͖͂̃ANV)
+			AnimData AnimDataAt(ksize_t index) const {
+				if (Content_->LazyIndex) { return AnimData(&Content_->LazyIndex->Anim(index, LazyErrorHandle(), LazyReplayFlag_), 0, Config().ThrowError()); }
+				return AnimData(&AirAnimData(), index, Config().ThrowError());
 			}
 
+		public:
 			/**
 			* @brief wԍ̑݊mF
 			*
@@ -1221,7 +4937,7 @@ namespace SAELib {
 			* @return bool  (false = ݂Ȃ : true = ݂)
 			*/
 			bool ExistAnimNumber(int32_t AnimNumber) {
-				return AnimNumberUMap.exist(AnimNumber);
+				return AnimNumberUMap().exist(AnimNumber);
 			}
 
 			/**
@@ -1229,20 +4945,20 @@ namespace SAELib {
 			*
 			* @w肵AjԍAIRf[^փANZX܂
 			*
-			* @Ώۂ݂ȂꍇAIRConfig::SetThrowError̐ݒɏ܂
+			* @Ώۂ݂Ȃꍇ͓ǂݍݎAIRConfig::SetThrowError̐ݒ(SetConfigŎw肵ꍇ͂̐ݒ)ɏ܂
 			*
 			* @param int32_t AnimNumber Ajԍ
 			* @retval Ώۂ݂ AnimData
 			* @retval Ώۂ݂Ȃ AIRConfig::SetThrowError (false = _~[f[^̎QƁFtrue = O𓊂)
 			*/
 			AnimData GetAnimData(int32_t AnimNumber) {
-				if (int32_t Value = AnimNumberUMap.find(AnimNumber); Value >= 0) { // SpriteExist(GroupNo, ImageNo)Ɠ`
-					return AnimData(&AirAnimData, Value);
+				if (int32_t Value = AnimNumberUMap().find(AnimNumber); Value >= 0) { // SpriteExist(GroupNo, ImageNo)Ɠ`
+					return AnimDataAt(static_cast<ksize_t>(Value));
 				}
-				if (!T_Config::Instance().ThrowError()) {
-					return AnimData(&AirAnimData, KSIZE_MAX);
+				if (!Config().ThrowError()) {
+					return AnimData(&AirAnimData(), KSIZE_MAX, false);
 				}
-				T_ErrorHandle::Instance().ThrowError(ErrorMessage::AnimNumberNotFound, AnimNumber);
+				T_ErrorHandle::ThrowError(ErrorMessage::AnimNumberNotFound, AnimNumber);
 			}
 
 			/**
@@ -1254,7 +4970,7 @@ namespace SAELib {
 			* @return bool  (false = ݂Ȃ : true = ݂)
 			*/
 			bool ExistAnimDataIndex(int32_t AnimDataIndex) const {
-				return static_cast<ksize_t>(AnimDataIndex) < AnimNumberUMap.size();
+				return static_cast<ksize_t>(AnimDataIndex) < AnimNumberUMap().size();
 			}
 
 			/**
@@ -1262,7 +4978,7 @@ namespace SAELib {
 			*
 			* @AIRf[^֎w肵CfbNXŃANZX܂
 			*
-			* @Ώۂ݂ȂꍇAIRConfig::SetThrowError̐ݒɏ܂
+			* @Ώۂ݂Ȃꍇ͓ǂݍݎAIRConfig::SetThrowError̐ݒ(SetConfigŎw肵ꍇ͂̐ݒ)ɏ܂
 			*
 			* @param int32_t index f[^zCfbNX
 			* @retval Ώۂ݂ AnimData
@@ -1270,12 +4986,80 @@ namespace SAELib {
 			*/
 			AnimData GetAnimDataIndex(int32_t index) const {
 				if (ExistAnimDataIndex(index)) {
-					return AnimData(&AirAnimData, index);
+					return AnimDataAt(static_cast<ksize_t>(index));
+				}
+				if (!Config().ThrowError()) {
+					return AnimData(&AirAnimData(), KSIZE_MAX, false);
+				}
+				T_ErrorHandle::ThrowError(ErrorMessage::AnimIndexNotFound, index);
+			}
+
+			/**
+			* @brief SAj͈̔͂擾
+			*
+			* @ǂݍ񂾑SAjCfbNXɑ͈͂Ԃ܂
+			*
+			* @͈͓̗vfGetAnimDataIndex(0)`GetAnimDataIndex(NumAnim() - 1)ƓłA͈͊mFs܂
+			*
+			* @Ce[^̓_ANZX\Ȃ߁Astd::for_each(std::execution::par, ...)Ȃǂɂn܂
+			*
+			* @AIRConfig::SetUseLazyParseONœǂݍ񂾏ꍇ́A͂̃Ajׂĉ͂ĂԂ܂
+			*
+			* @return AnimRange Aj͈̔
+			*/
+			AnimRange anims() const {
+				if (Content_->LazyIndex) { Content_->LazyIndex->ParseAll(LazyErrorHandle(), LazyReplayFlag_); }
+				return AnimRange(Content_.get(), Config().ThrowError());
+			}
+
+			/**
+			* @brief wXvCggp摜̈ꗗ擾
+			*
+			* @GroupNoEImageNõXvCg\摜́AAj̃CfbNXƃAj̉摜̃CfbNẌꗗԂ܂
+			*
+			* @ꗗ̓Aj̃CfbNXAAj͉摜̃CfbNXɕт܂
+			*
+			* @AIRConfig::SetUseSpriteIndexONœǂݍ񂾏ꍇ̂ݎgpłAꍇEgpĂȂꍇ͈͋̔͂Ԃ܂
+			*
+			* @param int32_t GroupNo O[vԍ
+			* @param int32_t ImageNo C[Wԍ
+			* @return SpriteRefRange QƐ͈̔
+			*/
+			SpriteRefRange GetSpriteRefs(int32_t GroupNo, int32_t ImageNo) const noexcept {
+				const auto [Begin, End] = Content_->SpriteIndex.find(GroupNo, ImageNo);
+				return SpriteRefRange(Begin, End);
+			}
+
+			/**
+			* @brief wAjgpXvCg̈ꗗ擾
+			*
+			* @AnimNumberList̃Aj̉摜\XvCgԍ(GroupNo, ImageNo)AdďɕԂ܂
+			*
+			* @݂ȂAjԍƁAO[vԍEC[Wԍȗꂽ摜͖܂
+			*
+			* @AIRConfig::SetUseLazyParseONœǂݍ񂾏ꍇ́Aw肵Aĵ݉͂܂
+			*
+			* @param const std::vector<int32_t>& AnimNumberList Ajԍ̈ꗗ
+			* @return std::vector<std::pair<int32_t, int32_t>> XvCgԍ(GroupNo, ImageNo)̈ꗗ
+			*/
+			std::vector<std::pair<int32_t, int32_t>> GetSpriteSet(const std::vector<int32_t>& AnimNumberList) const {
+				std::vector<uint32_t> KeyList = {};
+				for (const int32_t AnimNumber : AnimNumberList) {
+					const int32_t Index = AnimNumberUMap().find(AnimNumber);
+					if (Index < 0) { continue; }
+					for (const ElemView& Elem : AnimDataAt(static_cast<ksize_t>(Index)).elems()) {
+						if (T_SpriteIndex::ExistSprite(Elem)) { KeyList.push_back(T_SpriteIndex::SpriteKey(Elem.GroupNo(), Elem.ImageNo())); }
+					}
 				}
-				if (!T_Config::Instance().ThrowError()) {
-					return AnimData(&AirAnimData, KSIZE_MAX);
+				std::sort(KeyList.begin(), KeyList.end());
+				KeyList.erase(std::unique(KeyList.begin(), KeyList.end()), KeyList.end());
+
+				std::vector<std::pair<int32_t, int32_t>> SpriteSet = {};
+				SpriteSet.reserve(KeyList.size());
+				for (const uint32_t Key : KeyList) {
+					SpriteSet.emplace_back(static_cast<int32_t>(Key >> 16), static_cast<int32_t>(Key & 0xffff));
 				}
-				T_ErrorHandle::Instance().ThrowError(ErrorMessage::AnimIndexNotFound, index);
+				return SpriteSet;
 			}
 
 
@@ -1296,6 +5080,13 @@ namespace SAELib {
 	*/
 	using AIR = ReadAirFile_detail::T_AIRData;
 
+	/**
+	* @brief AIR::VisitAIRŉ͌ʂ󂯎NX̊
+	*
+	* @pĕKvȊ֐̂ݒ`܂(z֐ł͂Ȃ߁AĂяo̓CCWJł܂)
+	*/
+	using AIRVisitor = ReadAirFile_detail::T_AirVisitor;
+
 	/**
 	* @brief ReadAirFilẽG[
 	*/
@@ -1306,6 +5097,26 @@ namespace SAELib {
 	*/
 	namespace AIRConfig {
 
+		/**
+		* @brief ݒ̎ʂ
+		*
+		* @GetConfigŎ擾AAIR::SetConfigAIRf[^ƂɎwłݒł
+		*
+		* @eݒ Set/Get OŕύXE擾ł܂ (: Config.ThrowError(true)AConfig.UseArena())
+		*
+		* @AIRConfig̊eݒ֐̓vZXʂ̐ݒύXA擾ς݂̎ʂƓǂݍݒAIRf[^ɂ͉e܂
+		*/
+		using Config = ReadAirFile_detail::T_Config;
+
+		/**
+		* @brief ݂̐ݒ̎ʂ擾
+		*
+		* @AIRConfigŕύX݂̐ݒ𕡐ĕԂ܂
+		*
+		* @return Config ݒ̎ʂ
+		*/
+		inline Config GetConfig() { return *ReadAirFile_detail::T_Config::Snapshot(); }
+
 		///////////////////////////////////////////////////////////////////////////////////////////////////
 		// Setter /////////////////////////////////////////////////////////////////////////////////////////
 		///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1316,7 +5127,7 @@ namespace SAELib {
 		*
 		* @param bool flag (false = OƂċL^Ftrue = O𓊂)
 		*/
-		inline void SetThrowError(bool flag) { ReadAirFile_detail::T_Config::Instance().ThrowError(flag); }
+		inline void SetThrowError(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.ThrowError(flag); }); }
 
 		/**
 		* @brief G[Ot@C쐬ݒ
@@ -1325,7 +5136,7 @@ namespace SAELib {
 		*
 		* @param bool flag (false = Ot@Co͂ȂFtrue = Ot@Co͂)
 		*/
-		inline void SetCreateLogFile(bool flag) { ReadAirFile_detail::T_Config::Instance().CreateLogFile(flag); }
+		inline void SetCreateLogFile(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.CreateLogFile(flag); }); }
 
 		/**
 		* @brief SAELibtH_쐬ݒ
@@ -1336,10 +5147,12 @@ namespace SAELib {
 		* @param const std::string& Path SAELibtH_쐬 (ȗ̓pX̐ݒȂ)
 		*/
 		inline void SetCreateSAELibFile(bool flag, const std::string& Path = "") {
-			ReadAirFile_detail::T_Config::Instance().CreateSAELibFile(flag);
-			if (!Path.empty()) {
-				ReadAirFile_detail::T_Config::Instance().SAELibFilePath(Path);
-			}
+			ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) {
+				Config.CreateSAELibFile(flag);
+				if (!Path.empty()) {
+					Config.SAELibFilePath(Path);
+				}
+			});
 		}
 
 		/**
@@ -1349,7 +5162,7 @@ namespace SAELib {
 		*
 		* @param const std::string& Path SAELibtH_쐬
 		*/
-		inline void SetSAELibFilePath(const std::string& Path = "") { ReadAirFile_detail::T_Config::Instance().SAELibFilePath(Path); }
+		inline void SetSAELibFilePath(const std::string& Path = "") { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.SAELibFilePath(Path); }); }
 
 		/**
 		* @brief AIRt@ČpXݒ
@@ -1360,7 +5173,201 @@ namespace SAELib {
 		*
 		* @param const std::string& Path AIRt@Č̃pX
 		*/
-		inline void SetAIRSearchPath(const std::string& Path = "") { ReadAirFile_detail::T_Config::Instance().AIRSearchPath(Path); }
+		inline void SetAIRSearchPath(const std::string& Path = "") { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.AIRSearchPath(Path); }); }
+
+		/**
+		* @brief ڎQƃe[u̖xݒ
+		*
+		* @ǂݍ݌AAjԍ͈̔(ő - ŏ + 1)ɑ΂Aj̊wl(%)ȏȂAAjԍ̌ɒڎQƃe[ugp܂
+		*
+		* @0 = ͈͂(1048576)ȓȂɎgpF101ȏ = gpȂ@l25ł
+		*
+		* @param int32_t Density ڎQƃe[ugp閧x(0`101)
+		*/
+		inline void SetDenseIndexDensity(int32_t Density) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.DenseIndexDensity(Density); }); }
+
+		/**
+		* @brief }bvǂݍݐݒ
+		*
+		* @AIRt@C}bvœǂݍނwł܂
+		*
+		* @L̓t@CǂݎpŃ}bsOAs̃Rs[炸ɒډ͂܂
+		*
+		* @param bool flag (false = t@CXg[œǂݍށFtrue = }bvœǂݍ)
+		*/
+		inline void SetUseMappedFile(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.UseMappedFile(flag); }); }
+
+		/**
+		* @brief t@C̎gpݒ
+		*
+		* @AIRt@ČɁAJnpXƂ1x쐬t@Cgp邩wł܂
+		*
+		* @L2ڈȍ~̌ŃfBNg̑s܂
+		*
+		* @param bool flag (false = ǂݍ݂ƂɑFtrue = t@Cgp)
+		*/
+		inline void SetUseFileIndex(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.UseFileIndex(flag); }); }
+
+		/**
+		* @brief t@C̍XVؐݒ
+		*
+		* @t@CgpہA쐬ɃfBNg̍XVωĂ΍蒼wł܂
+		*
+		* @ɒǉꂽt@CRefreshFileIndexĂԂ܂Ō܂
+		*
+		* @param bool flag (false = ؂ȂFtrue = ƂɌ؂)
+		*/
+		inline void SetCheckFileIndexTime(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.CheckFileIndexTime(flag); }); }
+
+		/**
+		* @brief LbVt@C̎gpݒ
+		*
+		* @͍ς݂AIRf[^AIRt@CƓKw̃LbVt@C(gq .saecache)ɕۑAȍ~̓ǂݍ݂Ɏgp邩wł܂
+		*
+		* @AIRt@C̃pXETCYEXVƃCũo[WvALbVt@C̓ẽnbVvꍇ̂݃LbVǂݍ݂܂
+		*
+		* @͒ɃG[AIRt@C̃LbV͍쐬܂
+		*
+		* @param bool flag (false = gpȂFtrue = gp)
+		*/
+		inline void SetUseBinaryCache(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.UseBinaryCache(flag); }); }
+
+		/**
+		* @brief ͌ʂ̋Lݒ
+		*
+		* @AIRt@C𕡐AIRœǂݍޏꍇɁA͌ʂL邩wł܂
+		*
+		* @AIRt@C̃pXETCYEXVƉ͌ʂ̌`Ɋւݒ(x́EXvCgtE摜f[^̏dƏkEA[imہEڎQƃe[u̖x)vAǂݍݍς݂AIRcĂꍇ͉͂ȗēf[^QƂ܂
+		*
+		* @͂ȗꍇA͎ɔG[͓ԂŋL^܂(x͂Elem̃G[́AeAIRf[^ŏɎQƂɋL^܂)
+		*
+		* @Lꂽ͌ʂ͕ύXꂸAReloadAIR͐V͌ʂɍւ邽߁AAIRɂ͉e܂(ēǂݍ݂͌ʂ͋L܂)
+		*
+		* @param bool flag (false = LȂFtrue = L)
+		*/
+		inline void SetUseSharedData(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.UseSharedData(flag); }); }
+
+		/**
+		* @brief A[imېݒ
+		*
+		* @ǂݍAIRf[^(AjE摜Ep̍)AAIRf[^Ƃ1̃̈ւ܂Ƃ߂Ċmۂ邩wł܂
+		*
+		* @͌ɕKvȃTCY߂ċlߒ߁Amۉ񐔂AAIRf[^̔j1̉ōς݂܂
+		*
+		* @ǂݍ݂ƁELoadAIRBatchƂɐ؂ւ܂(ǂݍݍς݂AIRf[^ɂ͉e܂)
+		*
+		* @param bool flag (false = gpȂFtrue = gp)
+		*/
+		inline void SetUseArena(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.UseArena(flag); }); }
+
+		/**
+		* @brief x͐ݒ
+		*
+		* @ǂݍݎ[Begin Action]ŝ݂𑖍ăAjԍƔ͈͂L^AeAjElemGetAnimDataōŏɎQƂ_ŉ͂܂
+		*
+		* @os̃G[͓ǂݍݎɁAElem̃G[͊eAIRf[^̃AjŏɎQƂɋL^܂(LoadAIȐꍇ̓vZXʁALoadAIRCollectError/LoadAIRBatch̏ꍇAIRf[^)
+		*
+		* @Elem̃G[͎QƂɋL^邽߁Aʏ̉͂Ƃ͏ԂقȂꍇ܂@O𓊂ݒ̏ꍇAeAj̉͂1x݂̂ł
+		*
+		* @AjEAjԍ̏d͒ʏ̉͂Ɠ܂(ElemANV͓o^ꂸAG[͓ǂݍݎɋL^܂)
+		*
+		* @LbVt@CEA[imہÉEXvCgtE摜f[^̏d͎gpAReloadAIR͒ʏǂ肷ׂĉ͂܂
+		*
+		* @param bool flag (false = ǂݍݎɂׂĉ́Ftrue = QƎɉ)
+		*/
+		inline void SetUseLazyParse(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.UseLazyParse(flag); }); }
+
+		/**
+		* @brief XvCgt̍쐬ݒ
+		*
+		* @ǂݍݎɁAXvCgԍ(GroupNo, ImageNo)炻gpAjE摜쐬邩wł܂
+		*
+		* @쐬AIR::GetSpriteRefsŎgp܂(摜f[^1ɂ8byteǉŎgp܂)
+		*
+		* @AIRConfig::SetUseLazyParseON̏ꍇ͍쐬܂
+		*
+		* @param bool flag (false = 쐬ȂFtrue = 쐬)
+		*/
+		inline void SetUseSpriteIndex(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.UseSpriteIndex(flag); }); }
+
+		/**
+		* @brief 摜f[^̏dݒ
+		*
+		* @ǂݍ݌AS(XvCgԍEWE\ԁE]E)v摜f[^1ɂ܂Ƃ߂ĕێ邩wł܂
+		*
+		* @eAj͂܂Ƃ߂Y(摜f[^1ɂ4byte)ŎQƂ邽߁Ad20%̏ꍇ͎gpʂ܂
+		*
+		* @܂Ƃ߂GetLoadStatsNumElemENumUniqueElemŊmFł܂
+		*
+		* @AIRConfig::SetUseLazyParseON̏ꍇ͎gp܂
+		*
+		* @param bool flag (false = ܂Ƃ߂ȂFtrue = ܂Ƃ߂)
+		*/
+		inline void SetUseElemPool(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.UseElemPool(flag); }); }
+
+		/**
+		* @brief 摜f[^̏kݒ
+		*
+		* @ǂݍ݌AS摜f[^̍WE\Ԃ -32768`32767 Ɏ܂A]E߂̑gݍ킹65536ވȉ̏ꍇɁA摜f[^120byte12bytě`ŕێ邩wł܂
+		*
+		* @͈͊O̒l܂ރt@C͒ʏ̌`̂܂ܕێ܂A擾łl͂ǂ̌`łł
+		*
+		* @QƎɌ̌`֖߂߁AS摜̑OFF̏ꍇxȂ܂
+		*
+		* @ǂ̌`ŕێGetLoadStatsElemRecordSizeŊmFł܂
+		*
+		* @AIRConfig::SetUseElemPoolƕpꍇ́A܂Ƃ߂̉摜f[^k܂
+		*
+		* @AIRConfig::SetUseLazyParseON̏ꍇ͎gp܂
+		*
+		* @param bool flag (false = kȂFtrue = k)
+		*/
+		inline void SetUseNarrowElem(bool flag) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.UseNarrowElem(flag); }); }
+
+		/**
+		* @brief A[i̊mیݒ
+		*
+		* @SetUseArenaON̏ꍇɁAA[ï̗mۂ郁\[Xwł܂
+		*
+		* @w肵\[X́Agpēǂݍ񂾑SĂAIRf[^Ej܂ŗLłKv܂
+		*
+		* @mہE͔rČĂяo߁AXbhZ[tłȂ\[Xwł܂
+		*
+		* @param std::pmr::memory_resource* Resource mی (nullptȑꍇnew/delete)
+		*/
+		inline void SetArenaResource(std::pmr::memory_resource* Resource) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.ArenaResource(Resource); }); }
+
+		/**
+		* @brief ̓Xbhݒ
+		*
+		* @1AIRt@C[Begin Action]sŕAw肵Xbhŕɉ͂܂
+		*
+		* @t@CŜɂꍇ(t@CELoadAIRFromMemory)̂ݗLŁAt@CƃXg[̓ǂݍ݂1Xbhŉ͂܂
+		*
+		* @͌ʁEG[̓eƏԂ1Xbhŉ͂ꍇƓł
+		*
+		* @param int32_t Count Xbh(1 = 񉻂Ȃ(ݒ)F0 = n[hEFA̓s)
+		*/
+		inline void SetParseThreadCount(int32_t Count) { ReadAirFile_detail::T_Config::Update([&](ReadAirFile_detail::T_Config& Config) { Config.ParseThreadCount(Count); }); }
+
+		/**
+		* @brief t@C̍č쐬
+		*
+		* @w肵pX̃t@C蒼܂
+		*
+		* @pXȗׂ͂Ă̍jǍɍ蒼܂
+		*
+		* @param const std::string& Path 蒼JnpX
+		*/
+		inline void RefreshFileIndex(const std::string& Path = "") {
+			if (Path.empty()) {
+				ReadAirFile_detail::T_FileIndex::Instance().clear();
+				return;
+			}
+			ReadAirFile_detail::T_FilePathSystem IndexFolder(Path);
+			if (IndexFolder.ErrorCode() || !std::filesystem::is_directory(IndexFolder.Path())) { return; }
+			ReadAirFile_detail::T_FileIndex::Instance().Refresh(IndexFolder.Path());
+		}
 
 		///////////////////////////////////////////////////////////////////////////////////////////////////
 		// Getter /////////////////////////////////////////////////////////////////////////////////////////
@@ -1372,7 +5379,7 @@ namespace SAELib {
 		*
 		* @return bool G[ݒo͐؂ւݒ(false = OFFFtrue = ON)
 		*/
-		inline bool GetThrowError() { return ReadAirFile_detail::T_Config::Instance().ThrowError(); }
+		inline bool GetThrowError() { return ReadAirFile_detail::T_Config::Snapshot()->ThrowError(); }
 
 		/**
 		* @brief G[Ot@C쐬ݒ擾
@@ -1381,7 +5388,7 @@ namespace SAELib {
 		*
 		* @return bool G[Ot@C쐬ݒ(false = OFFFtrue = ON)
 		*/
-		inline bool GetCreateLogFile() { return ReadAirFile_detail::T_Config::Instance().CreateLogFile(); }
+		inline bool GetCreateLogFile() { return ReadAirFile_detail::T_Config::Snapshot()->CreateLogFile(); }
 
 		/**
 		* @brief SAELibtH_쐬ݒ擾
@@ -1390,7 +5397,115 @@ namespace SAELib {
 		*
 		* @return bool SAELibtH_쐬ݒ(false = OFFFtrue = ON)
 		*/
-		inline bool GetCreateSAELibFile() { return ReadAirFile_detail::T_Config::Instance().CreateSAELibFile(); }
+		inline bool GetCreateSAELibFile() { return ReadAirFile_detail::T_Config::Snapshot()->CreateSAELibFile(); }
+
+		/**
+		* @brief }bvǂݍݐݒ擾
+		*
+		* @Configݒ̃}bvǂݍݐݒ擾܂
+		*
+		* @return bool }bvǂݍݐݒ(false = OFFFtrue = ON)
+		*/
+		inline bool GetUseMappedFile() { return ReadAirFile_detail::T_Config::Snapshot()->UseMappedFile(); }
+
+		/**
+		* @brief t@C̎gpݒ擾
+		*
+		* @Configݒ̃t@C̎gpݒ擾܂
+		*
+		* @return bool t@C̎gpݒ(false = OFFFtrue = ON)
+		*/
+		inline bool GetUseFileIndex() { return ReadAirFile_detail::T_Config::Snapshot()->UseFileIndex(); }
+
+		/**
+		* @brief t@C̍XVؐݒ擾
+		*
+		* @Configݒ̃t@C̍XVؐݒ擾܂
+		*
+		* @return bool t@C̍XVؐݒ(false = OFFFtrue = ON)
+		*/
+		inline bool GetCheckFileIndexTime() { return ReadAirFile_detail::T_Config::Snapshot()->CheckFileIndexTime(); }
+
+		/**
+		* @brief LbVt@C̎gpݒ擾
+		*
+		* @Configݒ̃LbVt@C̎gpݒ擾܂
+		*
+		* @return bool LbVt@C̎gpݒ(false = OFFFtrue = ON)
+		*/
+		inline bool GetUseBinaryCache() { return ReadAirFile_detail::T_Config::Snapshot()->UseBinaryCache(); }
+
+		/**
+		* @brief ͌ʂ̋Lݒ擾
+		*
+		* @Configݒ̉͌ʂ̋Lݒ擾܂
+		*
+		* @return bool ͌ʂ̋Lݒ(false = OFFFtrue = ON)
+		*/
+		inline bool GetUseSharedData() { return ReadAirFile_detail::T_Config::Snapshot()->UseSharedData(); }
+
+		/**
+		* @brief A[imېݒ擾
+		*
+		* @Configݒ̃A[imېݒ擾܂
+		*
+		* @return bool A[imېݒ(false = OFFFtrue = ON)
+		*/
+		inline bool GetUseArena() { return ReadAirFile_detail::T_Config::Snapshot()->UseArena(); }
+
+		/**
+		* @brief x͐ݒ擾
+		*
+		* @Configݒ̒x͐ݒ擾܂
+		*
+		* @return bool x͐ݒ(false = OFFFtrue = ON)
+		*/
+		inline bool GetUseLazyParse() { return ReadAirFile_detail::T_Config::Snapshot()->UseLazyParse(); }
+
+		/**
+		* @brief XvCgt̍쐬ݒ擾
+		*
+		* @Configݒ̃XvCgt̍쐬ݒ擾܂
+		*
+		* @return bool XvCgt̍쐬ݒ(false = OFFFtrue = ON)
+		*/
+		inline bool GetUseSpriteIndex() { return ReadAirFile_detail::T_Config::Snapshot()->UseSpriteIndex(); }
+
+		/**
+		* @brief 摜f[^̏dݒ擾
+		*
+		* @Configݒ̉摜f[^̏dݒ擾܂
+		*
+		* @return bool 摜f[^̏dݒ(false = OFFFtrue = ON)
+		*/
+		inline bool GetUseElemPool() { return ReadAirFile_detail::T_Config::Snapshot()->UseElemPool(); }
+
+		/**
+		* @brief 摜f[^̏kݒ擾
+		*
+		* @Configݒ̉摜f[^̏kݒ擾܂
+		*
+		* @return bool 摜f[^̏kݒ(false = OFFFtrue = ON)
+		*/
+		inline bool GetUseNarrowElem() { return ReadAirFile_detail::T_Config::Snapshot()->UseNarrowElem(); }
+
+		/**
+		* @brief A[i̊mی擾
+		*
+		* @Configݒ̃A[i̊mی擾܂
+		*
+		* @return std::pmr::memory_resource* mی (w̏ꍇstd::pmr::new_delete_resource())
+		*/
+		inline std::pmr::memory_resource* GetArenaResource() { return ReadAirFile_detail::T_Config::Snapshot()->ArenaResource(); }
+
+		/**
+		* @brief ̓Xbh擾
+		*
+		* @Configݒ1t@C̉͂ɎgpXbh擾܂
+		*
+		* @return int32_t ̓Xbh(1 = 񉻂ȂF0 = n[hEFA̓s)
+		*/
+		inline int32_t GetParseThreadCount() { return ReadAirFile_detail::T_Config::Snapshot()->ParseThreadCount(); }
 
 		/**
 		* @brief Configݒ擾
@@ -1399,25 +5514,34 @@ namespace SAELib {
 		*
 		* @return int32_t Configݒ
 		*/
-		inline int32_t GetConfigFlag() { return ReadAirFile_detail::T_Config::Instance().BitFlag(); }
+		inline int32_t GetConfigFlag() { return ReadAirFile_detail::T_Config::Snapshot()->BitFlag(); }
 
 		/**
 		* @brief SAELibtH_쐬pX擾
 		*
 		* @ConfigݒSAELibtH_쐬pX擾܂
 		*
-		* @return const std::filesystem::path& SAELibtH_쐬pX
+		* @return std::filesystem::path SAELibtH_쐬pX
 		*/
-		inline const std::filesystem::path& GetSAELibFilePath() { return ReadAirFile_detail::T_Config::Instance().SAELibFilePath(); }
+		inline std::filesystem::path GetSAELibFilePath() { return ReadAirFile_detail::T_Config::Snapshot()->SAELibFilePath(); }
 
 		/**
 		* @brief AIRt@ČpX擾
 		*
 		* @ConfigݒAIRt@ČpX擾܂
 		*
-		* @return const std::filesystem::path& AIRt@ČpX
+		* @return std::filesystem::path AIRt@ČpX
+		*/
+		inline std::filesystem::path GetAIRSearchPath() { return ReadAirFile_detail::T_Config::Snapshot()->AIRSearchPath(); }
+
+		/**
+		* @brief ڎQƃe[u̖xݒ擾
+		*
+		* @Configݒ̒ڎQƃe[ugp閧x擾܂
+		*
+		* @return int32_t ڎQƃe[ugp閧x(%)
 		*/
-		inline const std::filesystem::path& GetAIRSearchPath() { return ReadAirFile_detail::T_Config::Instance().AIRSearchPath(); }
+		inline int32_t GetDenseIndexDensity() { return ReadAirFile_detail::T_Config::Snapshot()->DenseIndexDensity(); }
 	}
 } // namespace SAELib
 #endif
\ No newline at end of file
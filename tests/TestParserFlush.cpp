@@ -0,0 +1,240 @@
+/**
+* @file TestParserFlush.cpp
+* @brief Aj̊m莞̓o^ƁAeLXg̃Aj̊m̉AeXg
+*
+* @Ajԍ̓Aj̊m莞([Begin Action]s̓eLXg)ɓo^邽߁A
+* @Aj͓o^ꂸAԍ̌̃AjgpAȍ~̃Aj̃CfbNX܂
+*
+* @sŏIȂeLXg̍Ō̃Ajǂݍ܂܂
+*
+* @sƃeLXgŊm肵Aj̃G[śAǂݍݕ@ɂ炸ɂȂ܂
+*/
+
+#include "h_ReadAirFile.h"
+#include <fstream>		// std::ofstream
+#include <iostream>		// std::cerr
+#include <sstream>		// std::istringstream
+#include <vector>		// std::vector
+
+namespace {
+	int NumFailure = 0;
+
+	void Check(bool Result, const char* Mode, const char* Name, int Line) {
+		if (Result) { return; }
+		std::cerr << "TestParserFlush.cpp(" << Line << "): " << Mode << ": " << Name << "\n";
+		++NumFailure;
+	}
+#define CHECK(Expr) Check((Expr), Mode, #Expr, __LINE__)
+
+	struct T_Error {
+		int32_t ID;
+		int32_t Value;
+		int32_t Line;
+		bool operator==(const T_Error& Other) const { return ID == Other.ID && Value == Other.Value && Line == Other.Line; }
+	};
+
+	struct T_ErrorVisitor : SAELib::AIRVisitor {
+		std::vector<T_Error> ErrorList = {};
+		void Error(int32_t ErrorID, int32_t ErrorValue, int32_t ErrorLine) { ErrorList.push_back({ ErrorID, ErrorValue, ErrorLine }); }
+	};
+
+	std::vector<T_Error> VisitError(std::string_view Text) {
+		T_ErrorVisitor Visitor;
+		SAELib::AIR::VisitAIRFromMemory(Text, Visitor);
+		return Visitor.ErrorList;
+	}
+
+	std::vector<T_Error> ErrorList(const SAELib::AIR& Air) {
+		std::vector<T_Error> Result = {};
+		for (const auto& Error : Air.ErrorList()) { Result.push_back({ Error.ErrorID(), Error.ErrorValue(), Error.ErrorLine() }); }
+		return Result;
+	}
+
+	// ǂݍݕ@ƂɓʂɂȂ邩
+	template <class T_Test>
+	void Run(T_Test&& Test) {
+		for (const bool Lazy : { false, true }) {
+			SAELib::AIRConfig::SetUseLazyParse(Lazy);
+			Test(Lazy ? "memory/lazy" : "memory", [](SAELib::AIR& Air, std::string_view Text) { return Air.LoadAIRFromMemory(Text, "test"); });
+			Test(Lazy ? "stream/lazy" : "stream", [](SAELib::AIR& Air, std::string_view Text) {
+				std::istringstream Stream{ std::string(Text) };
+				return Air.LoadAIRFromStream(Stream, "test");
+			});
+		}
+		SAELib::AIRConfig::SetUseLazyParse(false);
+	}
+
+	// Aǰ̓ԍ̃Ajgp
+	void TestEmptyDuplicate() {
+		constexpr std::string_view kText =
+			"[Begin Action 10]\n"
+			"[Begin Action 10]\n"
+			"0,0, 0,0, 5\n";
+		Run([&](const char* Mode, auto&& Load) {
+			SAELib::AIR Air;
+			CHECK(Load(Air, kText));
+			CHECK(Air.NumAnim() == 1);
+			CHECK(Air.ExistAnimNumber(10));
+			CHECK(Air.ExistAnimDataIndex(0) && Air.GetAnimDataIndex(0).AnimNumber() == 10 && Air.GetAnimDataIndex(0).ElemDataSize() == 1);
+		});
+		const char* const Mode = "visit";
+		CHECK((VisitError(kText) == std::vector<T_Error>{ { SAELib::AIRError::EmptyAnimElem, 0, 2 } }));
+	}
+
+	// Aj͓o^ꂸAȍ~̃CfbNXȂ
+	void TestEmptyIndex() {
+		constexpr std::string_view kText =
+			"[Begin Action 1]\n"
+			"0,0, 0,0, 5\n"
+			"[Begin Action 2]\n"
+			"; no elements\n"
+			"[Begin Action 3]\n"
+			"1,1, 0,0, 5\n";
+		Run([&](const char* Mode, auto&& Load) {
+			SAELib::AIR Air;
+			CHECK(Load(Air, kText));
+			CHECK(Air.NumAnim() == 2);
+			CHECK(!Air.ExistAnimNumber(2));
+			CHECK(Air.ExistAnimDataIndex(1));
+			CHECK(Air.GetAnimDataIndex(1).AnimNumber() == 3);
+			CHECK(Air.GetAnimDataIndex(1).GetElemData(0).GroupNo() == 1);
+		});
+		const char* const Mode = "visit";
+		CHECK((VisitError(kText) == std::vector<T_Error>{ { SAELib::AIRError::EmptyAnimElem, 0, 5 } }));
+	}
+
+	// o^ς݂̔ԍ͏dƂēǂݔ΂
+	void TestDuplicate() {
+		constexpr std::string_view kText =
+			"[Begin Action 7]\n"
+			"0,0, 0,0, 5\n"
+			"[Begin Action 7]\n"
+			"1,0, 0,0, 5\n"
+			"2,0, 0,0, 5\n";
+		Run([&](const char* Mode, auto&& Load) {
+			SAELib::AIR Air;
+			CHECK(Load(Air, kText));
+			CHECK(Air.NumAnim() == 1);
+			CHECK(Air.GetAnimData(7).ElemDataSize() == 1);
+		});
+		const char* const Mode = "visit";
+		CHECK((VisitError(kText) == std::vector<T_Error>{ { SAELib::AIRError::DuplicateAnimNumber, 7, 3 } }));
+	}
+
+	// sŏIȂeLXg̍Ō̃Aj
+	void TestLastAnimWithoutNewLine() {
+		for (const std::string_view Text : {
+			std::string_view("[Begin Action 5]\n0,0, 0,0, 5\n1,0, 0,0, 5"),
+			std::string_view("[Begin Action 5]\r\n0,0, 0,0, 5\r\n1,0, 0,0, 5"),
+			std::string_view("[Begin Action 4]\n0,0, 0,0, 5\n[Begin Action 5]\nLoopstart\n0,0, 0,0, 5\n1,0, 0,0, 5") }) {
+			Run([&](const char* Mode, auto&& Load) {
+				SAELib::AIR Air;
+				CHECK(Load(Air, Text));
+				CHECK(Air.ExistAnimNumber(5));
+				CHECK(Air.GetAnimData(5).ElemDataSize() == 2);
+				CHECK(Air.GetAnimData(5).GetElemData(1).GroupNo() == 1);
+			});
+			const char* const Mode = "visit";
+			CHECK(VisitError(Text).empty());
+		}
+	}
+
+	// eLXg̋Aj
+	void TestLastAnimEmpty() {
+		constexpr std::string_view kText =
+			"[Begin Action 1]\n"
+			"0,0, 0,0, 5\n"
+			"[Begin Action 2]";
+		Run([&](const char* Mode, auto&& Load) {
+			SAELib::AIR Air;
+			CHECK(Load(Air, kText));
+			CHECK(Air.NumAnim() == 1);
+			CHECK(!Air.ExistAnimNumber(2));
+		});
+		const char* const Mode = "visit";
+		CHECK((VisitError(kText) == std::vector<T_Error>{ { SAELib::AIRError::EmptyAnimElem, 0, 3 } }));
+	}
+
+	// eLXg̉š͍sƂĐȂ(t@CEEXg[œsƃG[sɂȂ)
+	void TestLineCount() {
+		const std::filesystem::path Folder = std::filesystem::temp_directory_path() / "ReadAirFileTest";
+		std::filesystem::create_directories(Folder);
+		const std::filesystem::path FilePath = Folder / "linecount.air";
+
+		const struct {
+			std::string_view Text;
+			int32_t NumLine;
+		} kCase[] = {
+			{ "[Begin Action 1]\n0,0, 0,0, 5\n[Begin Action 2]\n", 3 },
+			{ "[Begin Action 1]\r\n0,0, 0,0, 5\r\n[Begin Action 2]\r\n", 3 },
+			{ "[Begin Action 1]\n0,0, 0,0, 5\n[Begin Action 2]", 3 },
+			{ "[Begin Action 1]\n0,0, 0,0, 5\n[Begin Action 2]\n\n", 4 },
+		};
+		for (const auto& Case : kCase) {
+			std::ofstream(FilePath, std::ios::binary).write(Case.Text.data(), static_cast<std::streamsize>(Case.Text.size()));
+			const std::vector<T_Error> Expected = { { SAELib::AIRError::EmptyAnimElem, 0, Case.NumLine } };
+
+			for (const bool Lazy : { false, true }) {
+				SAELib::AIRConfig::SetUseLazyParse(Lazy);
+				for (const bool Mapped : { false, true }) {
+					SAELib::AIRConfig::SetUseMappedFile(Mapped);
+					const char* const Mode = Mapped ? (Lazy ? "mapped/lazy" : "mapped") : (Lazy ? "ifstream/lazy" : "ifstream");
+					SAELib::AIR Air;
+					CHECK(Air.LoadAIRCollectError("linecount", Folder.string()));
+					CHECK(Air.GetLoadStats().NumLine == Case.NumLine);
+					CHECK(ErrorList(Air) == Expected);
+				}
+				SAELib::AIRConfig::SetUseMappedFile(false);
+
+				Run([&](const char* Mode, auto&& Load) {
+					SAELib::AIR Air;
+					CHECK(Load(Air, Case.Text));
+					CHECK(Air.GetLoadStats().NumLine == Case.NumLine);
+				});
+			}
+			SAELib::AIRConfig::SetUseLazyParse(false);
+
+			for (const bool Mapped : { false, true }) {
+				SAELib::AIRConfig::SetUseMappedFile(Mapped);
+				const char* const Mode = Mapped ? "visit mapped" : "visit ifstream";
+				T_ErrorVisitor Visitor;
+				CHECK(SAELib::AIR::VisitAIR("linecount", Folder.string(), Visitor));
+				CHECK(Visitor.ErrorList == Expected);
+			}
+			SAELib::AIRConfig::SetUseMappedFile(false);
+			{
+				const char* const Mode = "visit memory";
+				CHECK(VisitError(Case.Text) == Expected);
+			}
+			{
+				const char* const Mode = "visit stream";
+				T_ErrorVisitor Visitor;
+				std::istringstream Stream{ std::string(Case.Text) };
+				CHECK(SAELib::AIR::VisitAIRFromStream(Stream, Visitor));
+				CHECK(Visitor.ErrorList == Expected);
+			}
+		}
+
+		std::error_code ErrorCode = {};
+		std::filesystem::remove_all(Folder, ErrorCode);
+	}
+}
+
+int main() {
+	SAELib::AIRConfig::SetThrowError(false);
+	SAELib::AIRConfig::SetCreateLogFile(false);
+	SAELib::AIRConfig::SetCreateSAELibFile(false);
+
+	TestEmptyDuplicate();
+	TestEmptyIndex();
+	TestDuplicate();
+	TestLastAnimWithoutNewLine();
+	TestLastAnimEmpty();
+	TestLineCount();
+
+	if (NumFailure) {
+		std::cerr << NumFailure << " check(s) failed\n";
+		return 1;
+	}
+	return 0;
+}
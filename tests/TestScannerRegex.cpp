@@ -0,0 +1,406 @@
+/**
+* @file TestScannerRegex.cpp
+* @brief s(T_LineScanner)ƁAuO̐K\ɂs͂̍eXg
+*
+* @K\ɂ͂͂̃eXgɂ̂ݎcAȉv邱ƂmF܂
+*
+* @sPʁF[Begin Action] / Loopstart / Elems̔AAjԍEElem̊elAG[̓eƏ
+*
+* @t@CPʁFK\ŉ͂ꍇƓAjEElem(T_AirAnimData)ƁAVisitAIRFromMemoryɓnG[
+*
+* @Ώۂ͍AIRt@C(sȍs܂)AEl̍sA_ɑgݗĂsł
+*/
+
+#include "h_ReadAirFile.h"
+#include "h_AirGenerator.h"
+#include <iostream>		// std::cerr
+#include <regex>		// uO̍s
+#include <random>		// std::mt19937
+#include <set>			// o^ς݂̃Ajԍ
+#include <tuple>		// std::tie
+
+namespace {
+	namespace Detail = SAELib::ReadAirFile_detail;
+	namespace ErrorMessage = Detail::ErrorMessage;
+	namespace CheckRange = Detail::CheckRange;
+	using Convert = Detail::Convert;
+
+	int NumFailure = 0;
+	constexpr int kMaxReport = 20;
+
+	void Fail(const std::string& Message) {
+		if (++NumFailure <= kMaxReport) { std::cerr << Message << "\n"; }
+	}
+
+	std::string Quote(std::string_view Text) {
+		std::string Result = "\"";
+		for (const char c : Text) {
+			if (c == '\r') { Result += "\\r"; }
+			else if (c == '\t') { Result += "\\t"; }
+			else { Result += c; }
+		}
+		return Result + "\"";
+	}
+
+	struct T_Error {
+		int32_t ID;
+		int32_t Value;
+		int32_t Line;
+		bool operator==(const T_Error& Other) const { return ID == Other.ID && Value == Other.Value && Line == Other.Line; }
+		bool operator!=(const T_Error& Other) const { return !(*this == Other); }
+
+		bool operator<(const T_Error& Other) const { return std::tie(Line, ID, Value) < std::tie(Other.Line, Other.ID, Other.Value); }
+	};
+
+	// 1s̃G[̏Ԃ͔rȂ(T_AnimParam̓ߓx̕ϊ͊֐̈̕]Ɉˑ邽)
+	std::vector<T_Error> SortError(std::vector<T_Error> ErrorList) {
+		std::sort(ErrorList.begin(), ErrorList.end());
+		return ErrorList;
+	}
+
+	std::vector<T_Error> ErrorList(const Detail::T_ErrorHandle& ErrorHandle) {
+		std::vector<T_Error> Result = {};
+		for (const auto& Error : ErrorHandle.ErrorLists()) { Result.push_back({ Error.ErrorID(), Error.ErrorValue(), Error.ErrorLine() }); }
+		return SortError(std::move(Result));
+	}
+
+	// uO̐K\ɂs(G[̒l͕ϊs 0 ƂAeڂ1xϊ)
+	struct T_RegexParser {
+		inline static const std::regex AnimationDataBegin_re{ R"(\s*\[Begin Action (-?\d+)\]\s*(?:;(.*))?)" };
+		inline static const std::regex AnimationDataParam_re{ R"(\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*,?\s*(H?)\s*(V?)\s*,?\s*([ADS]?)\s*(-?\d+)?\s*,?\s*([ADS]?)\s*(-?\d+)?\s*([ADS]?)\s*(-?\d+)?\s*)" };
+		inline static const std::regex AnimationDataLoop_re{ R"(\s*Loopstart)" };
+
+		static constexpr int32_t kGroupNoIndex = 1;
+		static constexpr int32_t kImageNoIndex = 2;
+		static constexpr int32_t kPosXIndex = 3;
+		static constexpr int32_t kPosYIndex = 4;
+		static constexpr int32_t kElemTimeIndex = 5;
+		static constexpr int32_t kFacingIndex = 6;
+		static constexpr int32_t kVFacingIndex = 7;
+		static constexpr int32_t kAlphaIndex = 8;
+		static constexpr int32_t kAlphaAValueIndex = 9;
+		static constexpr int32_t kAlphaSValueIndex = 11;
+		static constexpr int32_t kAlphaDValueIndex = 13;
+
+		static bool MatchBegin(const std::string& TextLine, std::smatch& RegexMatch) { return std::regex_match(TextLine, RegexMatch, AnimationDataBegin_re); }
+		static bool MatchParam(const std::string& TextLine, std::smatch& RegexMatch) { return std::regex_match(TextLine, RegexMatch, AnimationDataParam_re); }
+		static bool MatchLoop(const std::string& TextLine) { return std::regex_match(TextLine, AnimationDataLoop_re); }
+
+		static int32_t AnimNumber(const std::smatch& RegexMatch, int32_t TextLineCount, Detail::T_ErrorHandle& ErrorHandle) {
+			int32_t ChersValue = 0;
+			const std::from_chars_result Result = std::from_chars(&*RegexMatch[1].first, &*RegexMatch[1].first + RegexMatch[1].length(), ChersValue);
+			if (Result.ec != std::errc{}) {
+				ErrorHandle.SetError(ErrorMessage::FromCharsConvertFailed, ChersValue, TextLineCount);
+				return -1;
+			}
+			if (!CheckRange::kAnimNumber.CheckRange(ChersValue)) {
+				ErrorHandle.SetError(ErrorMessage::AnimNumberOutOfRange, ChersValue, TextLineCount);
+				return -1;
+			}
+			return ChersValue;
+		}
+
+		static int32_t FromChars(const std::smatch& RegexMatch, int32_t index, int32_t TextLineCount, Detail::T_ErrorHandle& ErrorHandle) {
+			if (static_cast<int32_t>(RegexMatch.size()) <= index || !RegexMatch[index].matched || !RegexMatch[index].length()) { return 0; }
+
+			int32_t ChersValue = 0;
+			const std::from_chars_result Result = std::from_chars(&*RegexMatch[index].first, &*RegexMatch[index].first + RegexMatch[index].length(), ChersValue);
+			if (Result.ec != std::errc{}) {
+				ErrorHandle.SetError(ErrorMessage::FromCharsConvertFailed, ChersValue, TextLineCount);
+				return 0;
+			}
+
+			const auto Check = [&](const Detail::T_CheckRange& Range, int32_t ErrorID) {
+				if (Range.CheckRange(ChersValue)) { return ChersValue; }
+				ErrorHandle.SetError(ErrorID, ChersValue, TextLineCount);
+				return 0;
+			};
+			switch (index) {
+			case kGroupNoIndex: return Check(CheckRange::kSpriteGroupNo, ErrorMessage::SpriteGroupNoOutOfRange);
+			case kImageNoIndex: return Check(CheckRange::kSpriteImageNo, ErrorMessage::SpriteImageNoOutOfRange);
+			case kPosXIndex: return Check(CheckRange::kElemPosX, ErrorMessage::ElemPosXOutOfRange);
+			case kPosYIndex: return Check(CheckRange::kElemPosY, ErrorMessage::ElemPosYOutOfRange);
+			case kElemTimeIndex: return Check(CheckRange::kElemTime, ErrorMessage::ElemTimeOutOfRange);
+			case kAlphaAValueIndex: return Check(CheckRange::kElemAlpha, ErrorMessage::ElemAlphaAOutOfRange);
+			case kAlphaSValueIndex: return Check(CheckRange::kElemAlpha, ErrorMessage::ElemAlphaSOutOfRange);
+			case kAlphaDValueIndex: return Check(CheckRange::kElemAlpha, ErrorMessage::ElemAlphaDOutOfRange);
+			}
+			return ChersValue;
+		}
+
+		static int32_t FromCharsAlpha(const std::smatch& RegexMatch, char Alpha, int32_t TextLineCount, Detail::T_ErrorHandle& ErrorHandle) {
+			for (int32_t AlphaLoop = kAlphaIndex; AlphaLoop < kAlphaDValueIndex; AlphaLoop += 2) {
+				if (RegexMatch[AlphaLoop] == std::string(1, Alpha)) { return FromChars(RegexMatch, AlphaLoop + 1, TextLineCount, ErrorHandle); }
+			}
+			return 0;
+		}
+
+		static Detail::T_AirAnimData::T_ElemData Elem(const std::smatch& RegexMatch, int32_t TextLineCount, Detail::T_ErrorHandle& ErrorHandle) {
+			const int32_t GroupNo = FromChars(RegexMatch, kGroupNoIndex, TextLineCount, ErrorHandle);
+			const int32_t ImageNo = FromChars(RegexMatch, kImageNoIndex, TextLineCount, ErrorHandle);
+			const int32_t PosX = FromChars(RegexMatch, kPosXIndex, TextLineCount, ErrorHandle);
+			const int32_t PosY = FromChars(RegexMatch, kPosYIndex, TextLineCount, ErrorHandle);
+			const int32_t ElemTime = FromChars(RegexMatch, kElemTimeIndex, TextLineCount, ErrorHandle);
+			const bool Facing = RegexMatch[kFacingIndex].length() != 0;
+			const bool VFacing = RegexMatch[kVFacingIndex].length() != 0;
+			const int32_t AlphaA = FromCharsAlpha(RegexMatch, 'A', TextLineCount, ErrorHandle);
+			const int32_t AlphaS = FromCharsAlpha(RegexMatch, 'S', TextLineCount, ErrorHandle);
+			const int32_t AlphaD = FromCharsAlpha(RegexMatch, 'D', TextLineCount, ErrorHandle);
+			return Detail::T_AirAnimData::T_ElemData(Convert::EncodeSpriteNumber(GroupNo, ImageNo), PosX, PosY, ElemTime,
+				Convert::EncodeAnimExtraParam(Facing, VFacing, AlphaA, AlphaS, AlphaD, GroupNo < 0 || GroupNo > 65535, ImageNo < 0 || ImageNo > 65535));
+		}
+	};
+
+	bool SameElem(const Detail::T_AirAnimData::T_ElemData& Expected, int32_t SpriteNumber, int32_t PosX, int32_t PosY, int32_t ElemTime, int32_t ExtraParam) {
+		return Expected.SpriteNumber() == SpriteNumber && Expected.PosX() == PosX && Expected.PosY() == PosY
+			&& Expected.ElemTime() == ElemTime && Expected.ExtraParam() == ExtraParam;
+	}
+
+	// 1s𗼕̕@ŉ͂Ĕr
+	void CompareLine(const std::string& TextLine) {
+		constexpr int32_t kLine = 1;
+		std::smatch RegexMatch;
+		Detail::T_LineMatch LineMatch = {};
+
+		const bool RegexBegin = T_RegexParser::MatchBegin(TextLine, RegexMatch);
+		const bool ScanBegin = Detail::T_ActionBegin::Scan(TextLine, LineMatch);
+		if (RegexBegin != ScanBegin) { Fail("[Begin Action] " + std::to_string(RegexBegin) + " vs " + std::to_string(ScanBegin) + ": " + Quote(TextLine)); }
+		else if (RegexBegin) {
+			Detail::T_ErrorHandle RegexError(false);
+			Detail::T_ErrorHandle ScanError(false);
+			const int32_t Expected = T_RegexParser::AnimNumber(RegexMatch, kLine, RegexError);
+			const Detail::T_ActionBegin ActionBegin(ScanError, LineMatch, kLine);
+			if (Expected != ActionBegin.AnimNumber() || ErrorList(RegexError) != ErrorList(ScanError)) { Fail("anim number: " + Quote(TextLine)); }
+		}
+
+		const bool RegexLoop = T_RegexParser::MatchLoop(TextLine);
+		if (RegexLoop != Detail::T_Loopstart::Scan(TextLine)) { Fail("Loopstart " + std::to_string(RegexLoop) + ": " + Quote(TextLine)); }
+
+		const bool RegexParam = T_RegexParser::MatchParam(TextLine, RegexMatch);
+		const bool ScanParam = Detail::T_AnimParam::Scan(TextLine, LineMatch);
+		if (RegexParam != ScanParam) { Fail("elem " + std::to_string(RegexParam) + " vs " + std::to_string(ScanParam) + ": " + Quote(TextLine)); }
+		else if (RegexParam) {
+			Detail::T_ErrorHandle RegexError(false);
+			Detail::T_ErrorHandle ScanError(false);
+			const Detail::T_AirAnimData::T_ElemData Expected = T_RegexParser::Elem(RegexMatch, kLine, RegexError);
+			const Detail::T_AnimParam AnimParam(ScanError, LineMatch, kLine);
+			if (!SameElem(Expected, AnimParam.SpriteNumber(), AnimParam.PosX(), AnimParam.PosY(), AnimParam.ElemTime(), AnimParam.ExtraParam())
+				|| ErrorList(RegexError) != ErrorList(ScanError)) {
+				Fail("elem values: " + Quote(TextLine));
+			}
+		}
+	}
+
+	// K\ŉ͂t@C̓e(T_AirTextParserƓAAj̊m莞ɓo^)
+	struct T_RegexAnim {
+		int32_t AnimNumber = 0;
+		bool ExistLoopstart = false;
+		int32_t Loopstart = 0;
+		std::vector<Detail::T_AirAnimData::T_ElemData> Elem = {};
+	};
+	struct T_RegexFile {
+		std::vector<T_RegexAnim> Anim = {};
+		std::vector<T_Error> Error = {};
+		std::vector<int32_t> ClsnLine = {};		// Clsns(K\̉͑ΏۊÔ߁AG[̔r珜)
+	};
+
+	T_RegexFile ParseRegex(std::string_view Text) {
+		T_RegexFile Result = {};
+		Detail::T_ErrorHandle ErrorHandle(false);
+		std::set<int32_t> Registered = {};
+		std::smatch RegexMatch;
+		Detail::T_LineMatch LineMatch = {};
+		bool Open = false;
+		T_RegexAnim Current = {};
+		int32_t TextLineCount = 0;
+
+		const auto Flush = [&]() {
+			if (!Open) { return; }
+			Open = false;
+			if (Current.Elem.empty()) {
+				ErrorHandle.SetError(ErrorMessage::EmptyAnimElem, 0, TextLineCount);
+				return;
+			}
+			Registered.insert(Current.AnimNumber);
+			Result.Anim.push_back(std::move(Current));
+		};
+
+		while (!Text.empty()) {
+			++TextLineCount;
+			const size_t LineEnd = Text.find('\n');
+			std::string TextLine(Text.substr(0, LineEnd));
+			Text.remove_prefix(LineEnd == std::string_view::npos ? Text.size() : LineEnd + 1);
+			if (!TextLine.empty() && TextLine.back() == '\r') { TextLine.pop_back(); }
+			if (TextLine.empty()) { continue; }
+			if (Detail::T_ClsnParam::Scan(TextLine, LineMatch)) { Result.ClsnLine.push_back(TextLineCount); }
+
+			if (T_RegexParser::MatchBegin(TextLine, RegexMatch)) {
+				Flush();
+				const int32_t AnimNumber = T_RegexParser::AnimNumber(RegexMatch, TextLineCount, ErrorHandle);
+				if (AnimNumber < 0) { continue; }
+				if (Registered.count(AnimNumber)) {
+					ErrorHandle.SetError(ErrorMessage::DuplicateAnimNumber, AnimNumber, TextLineCount);
+					continue;
+				}
+				Open = true;
+				Current = {};
+				Current.AnimNumber = AnimNumber;
+			}
+			else if (Open) {
+				if (!Current.ExistLoopstart && T_RegexParser::MatchLoop(TextLine)) {
+					Current.ExistLoopstart = true;
+					Current.Loopstart = static_cast<int32_t>(Current.Elem.size());
+					continue;
+				}
+				if (!T_RegexParser::MatchParam(TextLine, RegexMatch)) { continue; }
+				Current.Elem.push_back(T_RegexParser::Elem(RegexMatch, TextLineCount, ErrorHandle));
+			}
+		}
+		Flush();
+		Result.Error = ErrorList(ErrorHandle);
+		return Result;
+	}
+
+	struct T_ErrorVisitor : SAELib::AIRVisitor {
+		std::vector<T_Error> ErrorList = {};
+		void Error(int32_t ErrorID, int32_t ErrorValue, int32_t ErrorLine) { ErrorList.push_back({ ErrorID, ErrorValue, ErrorLine }); }
+	};
+
+	// t@CŜ𐳋K\LoadAIRFromMemoryEVisitAIRFromMemoryŉ͂Ĕr
+	void CompareFile(const std::string& Name, std::string_view Text) {
+		const T_RegexFile Expected = ParseRegex(Text);
+
+		SAELib::AIR Air;
+		Air.LoadAIRFromMemory(Text, Name);
+		if (Air.NumAnim() != static_cast<int32_t>(Expected.Anim.size())) {
+			Fail(Name + ": " + std::to_string(Air.NumAnim()) + " anims, expected " + std::to_string(Expected.Anim.size()));
+			return;
+		}
+		for (int32_t AnimIndex = 0; AnimIndex < Air.NumAnim(); ++AnimIndex) {
+			const T_RegexAnim& ExpectedAnim = Expected.Anim[static_cast<size_t>(AnimIndex)];
+			const SAELib::AIR::AnimData Anim = Air.GetAnimDataIndex(AnimIndex);
+			const bool SameAnim = Anim.AnimNumber() == ExpectedAnim.AnimNumber && Anim.ExistLoopstart() == ExpectedAnim.ExistLoopstart
+				&& Anim.ElemLoopstart() == ExpectedAnim.Loopstart && Anim.ElemDataSize() == static_cast<int32_t>(ExpectedAnim.Elem.size())
+				&& Air.GetAnimData(ExpectedAnim.AnimNumber).AnimNumber() == ExpectedAnim.AnimNumber;
+			if (!SameAnim) {
+				Fail(Name + ": anim index " + std::to_string(AnimIndex) + " (" + std::to_string(ExpectedAnim.AnimNumber) + ") differs");
+				continue;
+			}
+			for (int32_t ElemIndex = 0; ElemIndex < Anim.ElemDataSize(); ++ElemIndex) {
+				const auto& ExpectedElem = ExpectedAnim.Elem[static_cast<size_t>(ElemIndex)];
+				const auto Elem = Anim.GetElemData(ElemIndex);
+				const bool SameValue = Elem.GroupNo() == ExpectedElem.GroupNo() && Elem.ImageNo() == ExpectedElem.ImageNo()
+					&& Elem.PosX() == ExpectedElem.PosX() && Elem.PosY() == ExpectedElem.PosY() && Elem.ElemTime() == ExpectedElem.ElemTime()
+					&& Elem.Facing() == ExpectedElem.Facing() && Elem.VFacing() == ExpectedElem.VFacing()
+					&& Elem.AlphaA() == ExpectedElem.AlphaA() && Elem.AlphaS() == ExpectedElem.AlphaS() && Elem.AlphaD() == ExpectedElem.AlphaD();
+				if (!SameValue) { Fail(Name + ": anim " + std::to_string(ExpectedAnim.AnimNumber) + " elem " + std::to_string(ElemIndex) + " differs"); }
+			}
+		}
+
+		T_ErrorVisitor Visitor;
+		SAELib::AIR::VisitAIRFromMemory(Text, Visitor);
+		std::vector<T_Error> VisitError = {};
+		for (const T_Error& Error : Visitor.ErrorList) {
+			if (!std::binary_search(Expected.ClsnLine.begin(), Expected.ClsnLine.end(), Error.Line)) { VisitError.push_back(Error); }
+		}
+		VisitError = SortError(std::move(VisitError));
+		if (VisitError != Expected.Error) {
+			size_t Index = 0;
+			while (Index < VisitError.size() && Index < Expected.Error.size() && VisitError[Index] == Expected.Error[Index]) { ++Index; }
+			Fail(Name + ": " + std::to_string(VisitError.size()) + " errors, expected " + std::to_string(Expected.Error.size()) + ", first difference at #" + std::to_string(Index));
+		}
+	}
+
+	// El̍s
+	const std::vector<std::string> kEdgeLine = {
+		"[Begin Action 0]", "[Begin Action 5]", "  [Begin Action 5]  ", "\t[Begin Action 5]\t; comment", "[Begin Action 5];",
+		"[Begin Action 5] ;", "[Begin Action 5] x", "[Begin Action 5]]", "[Begin Action  5]", "[Begin Action -0]", "[Begin Action -1]",
+		"[Begin Action 2147483647]", "[Begin Action 2147483648]", "[Begin Action 99999999999]", "[Begin Action ]", "[begin action 5]",
+		"[Begin Action 5", "[Begin Action 5] ; a ; b", "[Begin Action 5]\r", "[Begin Action 5] ;\r",
+		"Loopstart", "  Loopstart", "Loopstart ", "Loopstart\t", "LoopStart", "Loopstart;", "Loopstart x", "loopstart", "Loop start",
+		"0,0, 0,0, 5", "0,0,0,0,5", " 0 , 0 , 0 , 0 , 5 ", "-1,-1, -10,-20, -1", "0,0, 0,0", "0,0, 0,0,", "0,0, 0,0, 5,", "0,0, 0,0, 5,,",
+		"0,0, 0,0, 5,,,", "0,0, 0,0, 5, H", "0,0, 0,0, 5, V", "0,0, 0,0, 5, HV", "0,0, 0,0, 5, H V", "0,0, 0,0, 5, VH", "0,0, 0,0, 5, HH",
+		"0,0, 0,0, 5, H,", "0,0, 0,0, 5, ,V", "0,0, 0,0, 5, H, A", "0,0, 0,0, 5,, A", "0,0, 0,0, 5,, S", "0,0, 0,0, 5,, D",
+		"0,0, 0,0, 5,, A1", "0,0, 0,0, 5,, AS128D128", "0,0, 0,0, 5,, AS256D0", "0,0, 0,0, 5,, A S D", "0,0, 0,0, 5,, A,S", "0,0, 0,0, 5,, A,S,D",
+		"0,0, 0,0, 5,, D1S2A3", "0,0, 0,0, 5,, AS-1D0", "0,0, 0,0, 5,, A999", "0,0, 0,0, 5,, 10", "0,0, 0,0, 5,, 10 20 30", "0,0, 0,0, 5,, 10 20 30 40",
+		"0,0, 0,0, 5,, A 1 , S 2 D 3", "0,0, 0,0, 5, HV, AS10D20 ", "0,0, 0,0, 5 ; comment", "0,0, 0,0, 5, X", "0,0, 0,0, 5 5",
+		"70000,0, 0,0, 5", "0,70000, 0,0, 5", "-2,0, 0,0, 5", "0,-2, 0,0, 5", "0,0, 2147483647,-2147483648, 5", "0,0, 2147483648,0, 5",
+		"0,0, 0,0, -2", "0,0, 0,0, 2147483647", "0,0, 99999999999,0, 5", "00,00, 00,00, 05", "--1,0, 0,0, 5", "0,0, 0,0, 5\r", "0,0, 0,0, 5, H\r",
+		"", " ", "\t", ";", "; comment", "Clsn2: 1", "Clsn2Default: 1", " Clsn2[0] = -10, 0, 10, -80", "garbage",
+	};
+
+	// s̒fЂ_ɑgݍ킹s
+	std::string RandomLine(std::mt19937& Random) {
+		static const std::vector<std::string> kToken = {
+			"0", "1", "5", "-", "-1", "65535", "70000", "2147483648", "99999999999", ",", ",", ",", " ", " ", "\t", "\r",
+			"H", "V", "A", "S", "D", "X", ";", "[Begin Action ", "]", "Loopstart", "Clsn2", "[0] = ",
+		};
+		std::string Line = {};
+		const int32_t NumToken = std::uniform_int_distribution<int32_t>(0, 16)(Random);
+		for (int32_t i = 0; i < NumToken; ++i) { Line += kToken[std::uniform_int_distribution<size_t>(0, kToken.size() - 1)(Random)]; }
+		return Line;
+	}
+
+	// Elemš`ɋ߂_ȍs(l5̌̏ȗ\ȗvf̑gݍ킹)
+	std::string RandomElemLine(std::mt19937& Random) {
+		static const std::vector<std::string> kTail = { "", ",", " ", "H", "V", "A", "S", "D", "1", "-1", "300", "A1", "S2", "D3", "AS", ",,", "HV" };
+		std::string Line = "1,2, 3,4, 5";
+		const int32_t NumToken = std::uniform_int_distribution<int32_t>(0, 8)(Random);
+		for (int32_t i = 0; i < NumToken; ++i) { Line += kTail[std::uniform_int_distribution<size_t>(0, kTail.size() - 1)(Random)]; }
+		return Line;
+	}
+}
+
+int main() {
+	SAELib::AIRConfig::SetThrowError(false);
+	SAELib::AIRConfig::SetCreateLogFile(false);
+	SAELib::AIRConfig::SetCreateSAELibFile(false);
+
+	// sP
+	for (const std::string& TextLine : kEdgeLine) { CompareLine(TextLine); }
+	std::mt19937 Random(1);
+	for (int32_t i = 0; i < 50000; ++i) {
+		CompareLine(RandomLine(Random));
+		CompareLine(RandomElemLine(Random));
+	}
+
+	// t@CP(AIRt@CEEl̍sƃ_ȍsׂt@C)
+	for (uint32_t Seed = 1; Seed <= 8; ++Seed) {
+		SAELib::AirGenerator::T_AirGenConfig Config = {};
+		Config.NumAnim = 300;
+		Config.NumElem = static_cast<int32_t>(Seed % 4) * 3;
+		Config.FlipRate = 0.5;
+		Config.AlphaRate = 0.5;
+		Config.CommentRate = 0.3;
+		Config.MalformedRate = Seed % 2 ? 0.1 : 0.0;
+		Config.CRLF = Seed % 3 == 0;
+		Config.Seed = Seed;
+		const std::string Text = SAELib::AirGenerator::Generate(Config);
+
+		size_t LineStart = 0;
+		while (LineStart < Text.size()) {
+			const size_t LineEnd = std::min(Text.find('\n', LineStart), Text.size());
+			std::string TextLine = Text.substr(LineStart, LineEnd - LineStart);
+			if (!TextLine.empty() && TextLine.back() == '\r') { TextLine.pop_back(); }
+			CompareLine(TextLine);
+			LineStart = LineEnd + 1;
+		}
+		CompareFile("generated seed " + std::to_string(Seed), Text);
+	}
+	std::string MixedText = {};
+	for (int32_t i = 0; i < 20000; ++i) {
+		const int32_t Kind = std::uniform_int_distribution<int32_t>(0, 9)(Random);
+		MixedText += Kind == 0 ? "[Begin Action " + std::to_string(std::uniform_int_distribution<int32_t>(-2, 300)(Random)) + "]"
+			: Kind < 3 ? kEdgeLine[std::uniform_int_distribution<size_t>(0, kEdgeLine.size() - 1)(Random)]
+			: Kind < 6 ? RandomElemLine(Random) : RandomLine(Random);
+		MixedText += '\n';
+	}
+	CompareFile("mixed", MixedText);
+	CompareFile("mixed without final newline", std::string_view(MixedText).substr(0, MixedText.size() - 1));
+
+	if (NumFailure) {
+		std::cerr << NumFailure << " difference(s) from the regex parser\n";
+		return 1;
+	}
+	return 0;
+}